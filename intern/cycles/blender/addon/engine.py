@@ -26,6 +26,11 @@ def _configure_argument_parser():
     parser.add_argument("--cycles-print-stats",
                         help="Print rendering statistics to stderr",
                         action='store_true')
+    parser.add_argument("--cycles-stats-json",
+                        help="Append a JSON report of render time and memory usage per frame to this file. "
+                             "The device memory peak includes memory kept from earlier frames, "
+                             "the host memory peak is that of the whole process",
+                        default=None)
     parser.add_argument("--cycles-device",
                         help="Set the device to use for Cycles, overriding user preferences and the scene setting."
                              "Valid options are 'CPU', 'CUDA', 'OPTIX', 'HIP' or 'METAL'."
@@ -48,6 +53,10 @@ def _parse_command_line():
         import _cycles
         _cycles.enable_print_stats()
 
+    if args.cycles_stats_json:
+        import _cycles
+        _cycles.set_stats_json_path(args.cycles_stats_json)
+
     if args.cycles_device:
         import _cycles
         _cycles.set_device_override(args.cycles_device)
@@ -392,6 +392,13 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         default=0.01,
     )
 
+    use_light_tree: BoolProperty(
+        name="Light Tree",
+        description="Sample lights using a hierarchy that takes their distance, orientation and power into account, "
+        "which reduces noise in scenes with many lights",
+        default=False,
+    )
+
     use_adaptive_sampling: BoolProperty(
         name="Use Adaptive Sampling",
         description="Automatically reduce the number of samples per pixel based on estimated noise level",
@@ -804,6 +811,25 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         description="",
         min=8, max=8192,
     )
+    use_texture_cache: BoolProperty(
+        name="Texture Cache",
+        description="Load image textures on demand in tiles and mipmap levels, instead of fully into memory before rendering. "
+        "Tiled and mipmapped .tx files are used directly, for other images these are generated while rendering. "
+        "Only supported for CPU rendering with SVM shading",
+        default=False,
+    )
+    texture_cache_size: IntProperty(
+        name="Cache Size",
+        description="Maximum memory used by the texture cache, in megabytes",
+        default=4096,
+        min=64, soft_max=65536,
+    )
+    use_coherent_shading: BoolProperty(
+        name="Coherent Shading",
+        description="Trace a batch of paths together on the CPU and shade them sorted by material, "
+        "for better cache usage with many complex materials. Not supported for GPU rendering",
+        default=False,
+    )
 
     # Various fine-tuning debug flags
 
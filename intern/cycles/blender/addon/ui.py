@@ -314,6 +314,7 @@ class CYCLES_RENDER_PT_sampling_advanced(CyclesButtonsPanel, Panel):
         col.prop(cscene, "min_light_bounces")
         col.prop(cscene, "min_transparent_bounces")
         col.prop(cscene, "light_sampling_threshold", text="Light Threshold")
+        col.prop(cscene, "use_light_tree")
 
         for view_layer in scene.view_layers:
             if view_layer.samples > 0:
@@ -634,6 +635,7 @@ class CYCLES_RENDER_PT_performance_threads(CyclesButtonsPanel, Panel):
         layout.use_property_decorate = False
 
         scene = context.scene
+        cscene = scene.cycles
         rd = scene.render
 
         col = layout.column()
@@ -643,6 +645,10 @@ class CYCLES_RENDER_PT_performance_threads(CyclesButtonsPanel, Panel):
         sub.enabled = rd.threads_mode == 'FIXED'
         sub.prop(rd, "threads")
 
+        col = layout.column()
+        col.active = use_cpu(context)
+        col.prop(cscene, "use_coherent_shading")
+
 
 class CYCLES_RENDER_PT_performance_memory(CyclesButtonsPanel, Panel):
     bl_label = "Memory"
@@ -662,6 +668,13 @@ class CYCLES_RENDER_PT_performance_memory(CyclesButtonsPanel, Panel):
         sub.active = cscene.use_auto_tile
         sub.prop(cscene, "tile_size")
 
+        col = layout.column()
+        col.active = use_cpu(context) and not cscene.shading_system
+        col.prop(cscene, "use_texture_cache")
+        sub = col.column()
+        sub.active = cscene.use_texture_cache
+        sub.prop(cscene, "texture_cache_size")
+
 
 class CYCLES_RENDER_PT_performance_acceleration_structure(CyclesButtonsPanel, Panel):
     bl_label = "Acceleration Structure"
@@ -199,6 +199,13 @@ Geometry *BlenderSync::sync_geometry(BL::Depsgraph &b_depsgraph,
   return geom;
 }
 
+/* Geometry synced in this update may still be updated by a task in the geometry task pool, so
+ * consider it modified instead of reading its state while it is being written. */
+bool BlenderSync::geometry_is_modified(Geometry *geom) const
+{
+  return geometry_synced.find(geom) != geometry_synced.end() || geom->is_modified();
+}
+
 void BlenderSync::sync_geometry_motion(BL::Depsgraph &b_depsgraph,
                                        BObjectInfo &b_ob_info,
                                        Object *object,
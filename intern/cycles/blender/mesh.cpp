@@ -37,8 +37,46 @@
 
 #include "mikktspace.h"
 
+#include "DNA_meshdata_types.h"
+
 CCL_NAMESPACE_BEGIN
 
+/* Direct access to the Blender mesh arrays. Going through RNA for every element is slow for
+ * large meshes, and the arrays are laid out contiguously anyway. */
+
+static const MVert *mesh_verts(BL::Mesh &b_mesh)
+{
+  return static_cast<const MVert *>(b_mesh.vertices[0].ptr.data);
+}
+
+static const MPoly *mesh_polys(BL::Mesh &b_mesh)
+{
+  return static_cast<const MPoly *>(b_mesh.polygons[0].ptr.data);
+}
+
+static const MLoop *mesh_loops(BL::Mesh &b_mesh)
+{
+  return static_cast<const MLoop *>(b_mesh.loops[0].ptr.data);
+}
+
+static const MLoopTri *mesh_looptris(BL::Mesh &b_mesh)
+{
+  return static_cast<const MLoopTri *>(b_mesh.loop_triangles[0].ptr.data);
+}
+
+/* Split normals are only available after Mesh.split_faces() or Mesh.calc_normals_split(), RNA
+ * returns zero vectors otherwise. */
+static bool mesh_has_loop_normals(BL::Mesh &b_mesh)
+{
+  return b_mesh.loops.length() != 0 && len_squared(get_float3(b_mesh.loops[0].normal())) != 0.0f;
+}
+
+template<typename T, typename TypedAttribute>
+static const T *attribute_data(TypedAttribute &b_attribute)
+{
+  return static_cast<const T *>(b_attribute.data[0].ptr.data);
+}
+
 /* Tangent Space */
 
 struct MikkUserData {
@@ -319,12 +357,13 @@ static void fill_generic_attribute(BL::Mesh &b_mesh,
 {
   switch (element) {
     case ATTR_ELEMENT_CORNER: {
-      for (BL::MeshLoopTriangle &t : b_mesh.loop_triangles) {
-        const int index = t.index() * 3;
-        BL::Array<int, 3> loops = t.loops();
-        data[index] = get_value_at_index(loops[0]);
-        data[index + 1] = get_value_at_index(loops[1]);
-        data[index + 2] = get_value_at_index(loops[2]);
+      const MLoopTri *looptris = mesh_looptris(b_mesh);
+      const int num_tris = b_mesh.loop_triangles.length();
+      for (int i = 0; i < num_tris; i++) {
+        const MLoopTri &tri = looptris[i];
+        data[i * 3] = get_value_at_index(tri.tri[0]);
+        data[i * 3 + 1] = get_value_at_index(tri.tri[1]);
+        data[i * 3 + 2] = get_value_at_index(tri.tri[2]);
       }
       break;
     }
@@ -336,8 +375,10 @@ static void fill_generic_attribute(BL::Mesh &b_mesh,
       break;
     }
     case ATTR_ELEMENT_FACE: {
-      for (BL::MeshLoopTriangle &t : b_mesh.loop_triangles) {
-        data[t.index()] = get_value_at_index(t.polygon_index());
+      const MLoopTri *looptris = mesh_looptris(b_mesh);
+      const int num_tris = b_mesh.loop_triangles.length();
+      for (int i = 0; i < num_tris; i++) {
+        data[i] = get_value_at_index(looptris[i].poly);
       }
       break;
     }
@@ -430,56 +471,68 @@ static void attr_create_generic(Scene *scene,
     switch (b_data_type) {
       case BL::Attribute::data_type_FLOAT: {
         BL::FloatAttribute b_float_attribute{b_attribute};
+        const MFloatProperty *src = attribute_data<MFloatProperty>(b_float_attribute);
         Attribute *attr = attributes.add(name, TypeFloat, element);
         float *data = attr->data_float();
-        fill_generic_attribute(
-            b_mesh, data, element, [&](int i) { return b_float_attribute.data[i].value(); });
+        if (element == ATTR_ELEMENT_VERTEX) {
+          /* Same layout as in Blender, copy as a whole. */
+          memcpy(data, src, sizeof(float) * b_mesh.vertices.length());
+        }
+        else {
+          fill_generic_attribute(b_mesh, data, element, [&](int i) { return src[i].f; });
+        }
         break;
       }
       case BL::Attribute::data_type_BOOLEAN: {
         BL::BoolAttribute b_bool_attribute{b_attribute};
+        const MBoolProperty *src = attribute_data<MBoolProperty>(b_bool_attribute);
         Attribute *attr = attributes.add(name, TypeFloat, element);
         float *data = attr->data_float();
         fill_generic_attribute(
-            b_mesh, data, element, [&](int i) { return (float)b_bool_attribute.data[i].value(); });
+            b_mesh, data, element, [&](int i) { return (src[i].b) ? 1.0f : 0.0f; });
         break;
       }
       case BL::Attribute::data_type_INT: {
         BL::IntAttribute b_int_attribute{b_attribute};
+        const MIntProperty *src = attribute_data<MIntProperty>(b_int_attribute);
         Attribute *attr = attributes.add(name, TypeFloat, element);
         float *data = attr->data_float();
-        fill_generic_attribute(
-            b_mesh, data, element, [&](int i) { return (float)b_int_attribute.data[i].value(); });
+        fill_generic_attribute(b_mesh, data, element, [&](int i) { return (float)src[i].i; });
         break;
       }
       case BL::Attribute::data_type_FLOAT_VECTOR: {
         BL::FloatVectorAttribute b_vector_attribute{b_attribute};
+        const float(*src)[3] = attribute_data<float[3]>(b_vector_attribute);
         Attribute *attr = attributes.add(name, TypeVector, element);
         float3 *data = attr->data_float3();
         fill_generic_attribute(b_mesh, data, element, [&](int i) {
-          BL::Array<float, 3> v = b_vector_attribute.data[i].vector();
-          return make_float3(v[0], v[1], v[2]);
+          return make_float3(src[i][0], src[i][1], src[i][2]);
         });
         break;
       }
       case BL::Attribute::data_type_FLOAT_COLOR: {
         BL::FloatColorAttribute b_color_attribute{b_attribute};
+        const MPropCol *src = attribute_data<MPropCol>(b_color_attribute);
         Attribute *attr = attributes.add(name, TypeRGBA, element);
         float4 *data = attr->data_float4();
         fill_generic_attribute(b_mesh, data, element, [&](int i) {
-          BL::Array<float, 4> v = b_color_attribute.data[i].color();
-          return make_float4(v[0], v[1], v[2], v[3]);
+          return make_float4(src[i].color[0], src[i].color[1], src[i].color[2], src[i].color[3]);
         });
         break;
       }
       case BL::Attribute::data_type_FLOAT2: {
         BL::Float2Attribute b_float2_attribute{b_attribute};
+        const float(*src)[2] = attribute_data<float[2]>(b_float2_attribute);
         Attribute *attr = attributes.add(name, TypeFloat2, element);
         float2 *data = attr->data_float2();
-        fill_generic_attribute(b_mesh, data, element, [&](int i) {
-          BL::Array<float, 2> v = b_float2_attribute.data[i].vector();
-          return make_float2(v[0], v[1]);
-        });
+        if (element == ATTR_ELEMENT_VERTEX) {
+          /* Same layout as in Blender, copy as a whole. */
+          memcpy(data, src, sizeof(float2) * b_mesh.vertices.length());
+        }
+        else {
+          fill_generic_attribute(
+              b_mesh, data, element, [&](int i) { return make_float2(src[i][0], src[i][1]); });
+        }
         break;
       }
       default:
@@ -938,10 +991,12 @@ static void create_mesh(Scene *scene,
   mesh->reserve_mesh(numverts, numtris);
 
   /* create vertex coordinates and normals */
-  BL::Mesh::vertices_iterator v;
-  for (b_mesh.vertices.begin(v); v != b_mesh.vertices.end(); ++v)
-    mesh->add_vertex(get_float3(v->co()));
+  const MVert *verts = mesh_verts(b_mesh);
+  for (int i = 0; i < numverts; i++) {
+    mesh->add_vertex(make_float3(verts[i].co[0], verts[i].co[1], verts[i].co[2]));
+  }
 
+  BL::Mesh::vertices_iterator v;
   AttributeSet &attributes = (subdivision) ? mesh->subd_attributes : mesh->attributes;
   Attribute *attr_N = attributes.add(ATTR_STD_VERTEX_NORMAL);
   float3 *N = attr_N->data_float3();
@@ -970,15 +1025,27 @@ static void create_mesh(Scene *scene,
 
   /* create faces */
   if (!subdivision) {
-    for (BL::MeshLoopTriangle &t : b_mesh.loop_triangles) {
-      BL::MeshPolygon p = b_mesh.polygons[t.polygon_index()];
-      int3 vi = get_int3(t.vertices());
+    const MLoopTri *looptris = mesh_looptris(b_mesh);
+    const MLoop *loops = mesh_loops(b_mesh);
+    const MPoly *polys = mesh_polys(b_mesh);
+
+    if (use_loop_normals && !mesh_has_loop_normals(b_mesh)) {
+      LOG(WARNING) << "Mesh " << b_mesh.name()
+                   << " uses auto smooth but has no split normals, using vertex normals";
+      use_loop_normals = false;
+    }
 
-      int shader = clamp(p.material_index(), 0, used_shaders.size() - 1);
-      bool smooth = p.use_smooth() || use_loop_normals;
+    for (int t = 0; t < numtris; t++) {
+      const MLoopTri &tri = looptris[t];
+      const MPoly &p = polys[tri.poly];
+      const int vi[3] = {
+          (int)loops[tri.tri[0]].v, (int)loops[tri.tri[1]].v, (int)loops[tri.tri[2]].v};
+
+      int shader = clamp((int)p.mat_nr, 0, used_shaders.size() - 1);
+      bool smooth = (p.flag & ME_SMOOTH) || use_loop_normals;
 
       if (use_loop_normals) {
-        BL::Array<float, 9> loop_normals = t.split_normals();
+        BL::Array<float, 9> loop_normals = b_mesh.loop_triangles[t].split_normals();
         for (int i = 0; i < 3; i++) {
           N[vi[i]] = make_float3(
               loop_normals[i * 3], loop_normals[i * 3 + 1], loop_normals[i * 3 + 2]);
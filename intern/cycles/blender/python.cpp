@@ -881,6 +881,15 @@ static PyObject *enable_print_stats_func(PyObject * /*self*/, PyObject * /*args*
   Py_RETURN_NONE;
 }
 
+static PyObject *set_stats_json_path_func(PyObject * /*self*/, PyObject *arg)
+{
+  PyObject *path_string = PyObject_Str(arg);
+  BlenderSession::stats_json_path = PyUnicode_AsUTF8(path_string);
+  Py_DECREF(path_string);
+
+  Py_RETURN_NONE;
+}
+
 static PyObject *get_device_types_func(PyObject * /*self*/, PyObject * /*args*/)
 {
   vector<DeviceType> device_types = Device::available_types();
@@ -969,6 +978,7 @@ static PyMethodDef methods[] = {
 
     /* Statistics. */
     {"enable_print_stats", enable_print_stats_func, METH_NOARGS, ""},
+    {"set_stats_json_path", set_stats_json_path_func, METH_O, ""},
 
     /* Compute Device selection */
     {"get_device_types", get_device_types_func, METH_VARARGS, ""},
@@ -35,6 +35,7 @@
 #include "util/color.h"
 #include "util/foreach.h"
 #include "util/function.h"
+#include "util/guarded_allocator.h"
 #include "util/hash.h"
 #include "util/log.h"
 #include "util/murmurhash.h"
@@ -53,6 +54,7 @@ CCL_NAMESPACE_BEGIN
 DeviceTypeMask BlenderSession::device_override = DEVICE_MASK_ALL;
 bool BlenderSession::headless = false;
 bool BlenderSession::print_render_stats = false;
+string BlenderSession::stats_json_path = "";
 
 BlenderSession::BlenderSession(BL::RenderEngine &b_engine,
                                BL::Preferences &b_userpref,
@@ -338,6 +340,48 @@ void BlenderSession::stamp_view_layer_metadata(Scene *scene, const string &view_
                             time_human_readable_from_seconds(total_time - render_time).c_str());
 }
 
+void BlenderSession::write_render_stats_json(double sync_time)
+{
+  RenderStats stats;
+  session->collect_statistics(&stats);
+
+  double total_time, render_time;
+  session->progress.get_time(total_time, render_time);
+
+  /* One JSON object per line, so that the reports of all frames and views rendered by a
+   * process can be appended to the same file. */
+  string report = "{";
+  report += string_printf("\"frame\": %d", b_scene.frame_current());
+  report += ", \"view_layer\": " + string_json_quote(b_rlay_name);
+  report += ", \"view\": " + string_json_quote(b_rview_name);
+  report += string_printf(", \"time\": {\"sync\": %f, \"total\": %f, \"render\": %f}",
+                          sync_time,
+                          total_time,
+                          render_time);
+  if (scene->update_stats) {
+    report += ", \"device_update\": " + scene->update_stats->json_report();
+  }
+  /* Peak memory usage is not tracked per frame: the device peak covers the render session since
+   * it was reset for this frame, including memory kept from earlier frames, and the host peak
+   * the whole process, so name them accordingly. */
+  report += string_printf(
+      ", \"memory\": {\"session_device_peak\": %zu, \"process_host_peak\": %zu",
+      session->stats.mem_peak,
+      util_guarded_get_mem_peak());
+  report += ", \"data\": " + stats.json_report() + "}";
+  report += "}\n";
+
+  FILE *file = path_fopen(stats_json_path, "a");
+  if (!file) {
+    fprintf(stderr,
+            "Failed to open %s for writing render statistics.\n",
+            stats_json_path.c_str());
+    return;
+  }
+  fputs(report.c_str(), file);
+  fclose(file);
+}
+
 void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
 {
   b_depsgraph = b_depsgraph_;
@@ -404,11 +448,13 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
     }
 
     /* update scene */
+    const double sync_start_time = time_dt();
     BL::Object b_camera_override(b_engine.camera_override());
     sync->sync_camera(b_render, b_camera_override, width, height, b_rview_name.c_str());
     sync->sync_data(
         b_render, b_depsgraph, b_v3d, b_camera_override, width, height, &python_thread_state);
     builtin_images_load();
+    const double sync_time = time_dt() - sync_start_time;
 
     /* Attempt to free all data which is held by Blender side, since at this
      * point we know that we've got everything to render current view layer.
@@ -441,9 +487,14 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
     session->reset(effective_session_params, buffer_params);
 
     /* render */
+    const bool write_stats_json = !b_engine.is_preview() && background &&
+                                  !stats_json_path.empty();
     if (!b_engine.is_preview() && background && print_render_stats) {
       scene->enable_update_stats();
     }
+    else if (write_stats_json) {
+      scene->enable_update_stats(false);
+    }
 
     session->start();
     session->wait();
@@ -454,6 +505,10 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
       printf("Render statistics:\n%s\n", stats.full_report().c_str());
     }
 
+    if (write_stats_json) {
+      write_render_stats_json(sync_time);
+    }
+
     if (session->progress.get_cancel())
       break;
   }
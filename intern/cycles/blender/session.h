@@ -132,7 +132,15 @@ class BlenderSession {
 
   static bool print_render_stats;
 
+  /* Append a JSON report of the time spent in each phase and the memory usage of every
+   * rendered view to this file. The device memory peak is reset when the session is reset for a
+   * frame, but includes memory kept from earlier frames. The host memory peak is never reset and
+   * covers the whole process. */
+  static string stats_json_path;
+
  protected:
+  void write_render_stats_json(double sync_time);
+
   void stamp_view_layer_metadata(Scene *scene, const string &view_layer_name);
 
   /* Check whether session error happened.
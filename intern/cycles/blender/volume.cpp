@@ -259,6 +259,7 @@ static void sync_volume_object(BL::BlendData &b_data,
   volume->set_clipping(b_render.clipping());
   volume->set_step_size(b_render.step_size());
   volume->set_object_space((b_render.space() == BL::VolumeRender::space_OBJECT));
+  volume->set_skip_empty_space(b_render.use_skip_empty_space());
 
   /* Find grid with matching name. */
   for (BL::VolumeGrid &b_grid : b_volume.grids) {
@@ -27,6 +27,7 @@
 #include "scene/scene.h"
 #include "session/buffers.h"
 
+#include "util/algorithm.h"
 #include "util/atomic.h"
 #include "util/log.h"
 #include "util/tbb.h"
@@ -67,6 +68,9 @@ void PathTraceWorkCPU::init_execution()
 {
   /* Cache per-thread kernel globals. */
   device_->get_cpu_kernel_thread_globals(kernel_thread_globals_);
+
+  coherent_states_.clear();
+  coherent_states_.resize(kernel_thread_globals_.size());
 }
 
 void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
@@ -75,8 +79,16 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
                                       int sample_offset)
 {
   const int64_t image_width = effective_buffer_params_.width;
-  const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
+
+  /* With coherent shading every work item is a horizontal span of pixels, rendered together. */
+  const bool use_coherent_shading = device_scene_->data.integrator.use_coherent_shading;
+  const int span_width = use_coherent_shading ? kCoherentShadingSpanWidth : 1;
+  const int64_t spans_per_row = divide_up(image_width, span_width);
+
+  /* Rows in order of priority, with fully converged rows skipped. */
+  vector<int> rows;
+  get_render_rows(rows);
+  const uint32_t num_rows = rows.size();
 
   if (device_->profiler.active()) {
     for (CPUKernelThreadGlobals &kernel_globals : kernel_thread_globals_) {
@@ -84,30 +96,47 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
     }
   }
 
+  /* Every thread pulls the next row from a shared cursor, so that rows are started in order of
+   * priority. A parallel loop over the rows would split them into ranges which are stolen in no
+   * particular order. */
+  uint32_t next_row = 0;
+
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    tbb::parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
-      if (is_cancel_requested()) {
-        return;
-      }
-
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
-
-      KernelWorkTile work_tile;
-      work_tile.x = effective_buffer_params_.full_x + x;
-      work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
-      work_tile.start_sample = start_sample;
-      work_tile.sample_offset = sample_offset;
-      work_tile.num_samples = 1;
-      work_tile.offset = effective_buffer_params_.offset;
-      work_tile.stride = effective_buffer_params_.stride;
-
+    const int num_threads = local_arena.max_concurrency();
+    tbb::parallel_for(0, num_threads, [&](int /*thread_task_index*/) {
       CPUKernelThreadGlobals *kernel_globals = kernel_thread_globals_get(kernel_thread_globals_);
 
-      render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+      for (uint32_t row_index = atomic_fetch_and_add_uint32(&next_row, 1); row_index < num_rows;
+           row_index = atomic_fetch_and_add_uint32(&next_row, 1)) {
+        const int y = rows[row_index];
+
+        for (int64_t span_index = 0; span_index < spans_per_row; ++span_index) {
+          if (is_cancel_requested()) {
+            return;
+          }
+
+          const int x = span_index * span_width;
+
+          KernelWorkTile work_tile;
+          work_tile.x = effective_buffer_params_.full_x + x;
+          work_tile.y = effective_buffer_params_.full_y + y;
+          work_tile.w = min(span_width, int(image_width - x));
+          work_tile.h = 1;
+          work_tile.start_sample = start_sample;
+          work_tile.sample_offset = sample_offset;
+          work_tile.num_samples = 1;
+          work_tile.offset = effective_buffer_params_.offset;
+          work_tile.stride = effective_buffer_params_.stride;
+
+          if (use_coherent_shading) {
+            render_samples_coherent(kernel_globals, work_tile, samples_num);
+          }
+          else {
+            render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+          }
+        }
+      }
     });
   });
   if (device_->profiler.active()) {
@@ -119,6 +148,61 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
   statistics.occupancy = 1.0f;
 }
 
+void PathTraceWorkCPU::get_render_rows(vector<int> &rows) const
+{
+  const int image_width = effective_buffer_params_.width;
+  const int image_height = effective_buffer_params_.height;
+
+  rows.resize(image_height);
+  for (int y = 0; y < image_height; ++y) {
+    rows[y] = y;
+  }
+
+  const KernelFilm &kfilm = device_scene_->data.film;
+  if (kfilm.pass_adaptive_aux_buffer == PASS_UNUSED) {
+    return;
+  }
+
+  /* Count pixels which are not yet converged in every row. The convergence check marks converged
+   * pixels with a non-zero value in the last channel of the auxiliary pass. */
+  const int full_x = effective_buffer_params_.full_x;
+  const int full_y = effective_buffer_params_.full_y;
+  const int offset = effective_buffer_params_.offset;
+  const int stride = effective_buffer_params_.stride;
+  const int pass_stride = kfilm.pass_stride;
+  const float *render_buffer = buffers_->buffer.data();
+
+  vector<int> num_active_pixels(image_height);
+
+  tbb::task_arena local_arena = local_tbb_arena_create(device_);
+  local_arena.execute([&]() {
+    tbb::parallel_for(0, image_height, [&](int y) {
+      const int64_t row_pixel_index = offset + full_x + int64_t(full_y + y) * stride;
+      const float *aux_w = render_buffer + row_pixel_index * pass_stride +
+                           kfilm.pass_adaptive_aux_buffer + 3;
+
+      int num_active = 0;
+      for (int x = 0; x < image_width; ++x) {
+        if (aux_w[int64_t(x) * pass_stride] == 0.0f) {
+          ++num_active;
+        }
+      }
+      num_active_pixels[y] = num_active;
+    });
+  });
+
+  /* Skip rows where all pixels converged, and render the rows with the most pixels left to sample
+   * first. Starting with the most expensive rows leaves only cheap rows at the end of the pass,
+   * so threads finish at about the same time instead of waiting for a single noisy row. */
+  rows.erase(std::remove_if(rows.begin(),
+                            rows.end(),
+                            [&](const int y) { return num_active_pixels[y] == 0; }),
+             rows.end());
+  std::stable_sort(rows.begin(), rows.end(), [&](const int a, const int b) {
+    return num_active_pixels[a] > num_active_pixels[b];
+  });
+}
+
 void PathTraceWorkCPU::render_samples_full_pipeline(KernelGlobalsCPU *kernel_globals,
                                                     const KernelWorkTile &work_tile,
                                                     const int samples_num)
@@ -166,6 +250,81 @@ void PathTraceWorkCPU::render_samples_full_pipeline(KernelGlobalsCPU *kernel_glo
   }
 }
 
+void PathTraceWorkCPU::render_samples_coherent(KernelGlobalsCPU *kernel_globals,
+                                               const KernelWorkTile &work_tile,
+                                               const int samples_num)
+{
+  const bool has_bake = device_scene_->data.bake.use;
+  const int num_pixels = work_tile.w;
+
+  /* Two states per pixel, the second one is used by the shadow catcher to split the path. */
+  const int thread_index = tbb::this_task_arena::current_thread_index();
+  vector<IntegratorStateCPU> &states = coherent_states_[thread_index];
+  if (states.empty()) {
+    states.resize(kCoherentShadingSpanWidth * 2);
+  }
+
+  vector<int> active_states;
+  active_states.reserve(num_pixels * 2);
+
+  KernelWorkTile pixel_work_tile = work_tile;
+  pixel_work_tile.w = 1;
+  float *render_buffer = buffers_->buffer.data();
+
+  for (int sample = 0; sample < samples_num; ++sample) {
+    if (is_cancel_requested()) {
+      break;
+    }
+
+    for (int i = 0; i < num_pixels; i++) {
+      IntegratorStateCPU *state = &states[i * 2];
+      path_state_init_queues(state);
+      path_state_init_queues(state + 1);
+
+      pixel_work_tile.x = work_tile.x + i;
+      if (has_bake) {
+        kernels_.integrator_init_from_bake(kernel_globals, state, &pixel_work_tile, render_buffer);
+      }
+      else {
+        kernels_.integrator_init_from_camera(
+            kernel_globals, state, &pixel_work_tile, render_buffer);
+      }
+    }
+
+    /* Advance all paths one kernel at a time. In between, group the paths by the kernel they
+     * execute next, and surfaces by shader, so consecutive paths run the same code on the same
+     * data. Paths that split for the shadow catcher join in the next step. */
+    while (true) {
+      active_states.clear();
+      for (int i = 0; i < num_pixels * 2; i++) {
+        if (INTEGRATOR_STATE(&states[i], path, queued_kernel)) {
+          active_states.push_back(i);
+        }
+      }
+
+      if (active_states.empty()) {
+        break;
+      }
+
+      std::sort(active_states.begin(), active_states.end(), [&](const int a, const int b) {
+        const uint32_t kernel_a = INTEGRATOR_STATE(&states[a], path, queued_kernel);
+        const uint32_t kernel_b = INTEGRATOR_STATE(&states[b], path, queued_kernel);
+        if (kernel_a != kernel_b) {
+          return kernel_a < kernel_b;
+        }
+        return INTEGRATOR_STATE(&states[a], path, shader_sort_key) <
+               INTEGRATOR_STATE(&states[b], path, shader_sort_key);
+      });
+
+      for (const int i : active_states) {
+        kernels_.integrator_megakernel_step(kernel_globals, &states[i], render_buffer);
+      }
+    }
+
+    ++pixel_work_tile.start_sample;
+  }
+}
+
 void PathTraceWorkCPU::copy_to_display(PathTraceDisplay *display,
                                        PassMode pass_mode,
                                        int num_samples)
@@ -64,11 +64,25 @@ class PathTraceWorkCPU : public PathTraceWork {
   virtual void cryptomatte_postproces() override;
 
  protected:
+  /* Get the rows of the image to render in this pass, in the order in which they are to be
+   * scheduled. With adaptive sampling the rows with the most unconverged pixels come first and
+   * fully converged rows are left out. */
+  void get_render_rows(vector<int> &rows) const;
+
   /* Core path tracing routine. Renders given work time on the given queue. */
   void render_samples_full_pipeline(KernelGlobalsCPU *kernel_globals,
                                     const KernelWorkTile &work_tile,
                                     const int samples_num);
 
+  /* Render a span of pixels with interleaved paths that are sorted by kernel and shader in
+   * between kernels, for more coherent memory access when there are many different shaders. */
+  void render_samples_coherent(KernelGlobalsCPU *kernel_globals,
+                               const KernelWorkTile &work_tile,
+                               const int samples_num);
+
+  /* Number of pixels rendered together with coherent shading. */
+  static constexpr int kCoherentShadingSpanWidth = 32;
+
   /* CPU kernels. */
   const CPUKernels &kernels_;
 
@@ -78,6 +92,9 @@ class PathTraceWorkCPU : public PathTraceWork {
    * accessing it, but some "localization" is required to decouple from kernel globals stored
    * on the device level. */
   vector<CPUKernelThreadGlobals> kernel_thread_globals_;
+
+  /* Per-thread integrator states for coherent shading, allocated on first use. */
+  vector<vector<IntegratorStateCPU>> coherent_states_;
 };
 
 CCL_NAMESPACE_END
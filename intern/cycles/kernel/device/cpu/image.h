@@ -587,6 +587,11 @@ ccl_device float4 kernel_tex_image_interp(KernelGlobals kg, int id, float x, flo
 {
   const TextureInfo &info = kernel_tex_fetch(__texture_info, id);
 
+  if (info.cache_image) {
+    /* Without derivatives, sample the full resolution image. */
+    return ((const TextureCacheImage *)info.cache_image)->lookup(x, y, 0.0f, 0.0f, 0.0f, 0.0f);
+  }
+
   switch (info.data_type) {
     case IMAGE_DATA_TYPE_HALF:
       return TextureInterpolator<half>::interp(info, x, y);
@@ -611,6 +616,20 @@ ccl_device float4 kernel_tex_image_interp(KernelGlobals kg, int id, float x, flo
   }
 }
 
+/* Lookup with derivatives of the texture coordinates, used by images in the texture cache to
+ * select a mipmap level. */
+ccl_device float4 kernel_tex_image_interp_differentials(
+    KernelGlobals kg, int id, float x, float y, float2 dx, float2 dy)
+{
+  const TextureInfo &info = kernel_tex_fetch(__texture_info, id);
+
+  if (info.cache_image) {
+    return ((const TextureCacheImage *)info.cache_image)->lookup(x, y, dx.x, dx.y, dy.x, dy.y);
+  }
+
+  return kernel_tex_image_interp(kg, id, x, y);
+}
+
 ccl_device float4 kernel_tex_image_interp_3d(KernelGlobals kg,
                                              int id,
                                              float3 P,
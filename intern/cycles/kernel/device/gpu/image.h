@@ -223,6 +223,13 @@ ccl_device float4 kernel_tex_image_interp(KernelGlobals kg, int id, float x, flo
   }
 }
 
+/* Images are always in device memory on the GPU, so derivatives are not needed. */
+ccl_device float4 kernel_tex_image_interp_differentials(
+    KernelGlobals kg, int id, float x, float y, float2 dx, float2 dy)
+{
+  return kernel_tex_image_interp(kg, id, x, y);
+}
+
 ccl_device float4 kernel_tex_image_interp_3d(KernelGlobals kg,
                                              int id,
                                              float3 P,
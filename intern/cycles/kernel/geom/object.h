@@ -67,8 +67,9 @@ ccl_device_inline Transform object_fetch_motion_pass_transform(KernelGlobals kg,
                                                                int object,
                                                                enum ObjectVectorTransform type)
 {
-  int offset = object * OBJECT_MOTION_PASS_SIZE + (int)type;
-  return kernel_tex_fetch(__object_motion_pass, offset);
+  /* Objects without motion share identity transforms at offset zero. */
+  const uint motion_offset = kernel_tex_fetch(__objects, object).motion_offset;
+  return kernel_tex_fetch(__object_motion_pass, motion_offset + (int)type);
 }
 
 /* Motion blurred object transformations */
@@ -92,6 +92,20 @@ ccl_device float4 volume_attribute_float4(KernelGlobals kg,
   }
 }
 
+/* Test if any voxel grid of the volume object has values above the clipping threshold near the
+ * shading position. Volumes without an occupancy grid are always considered occupied. */
+ccl_device bool volume_is_occupied(KernelGlobals kg, ccl_private const ShaderData *sd)
+{
+  const AttributeDescriptor desc = find_attribute(kg, sd, ATTR_STD_VOLUME_OCCUPANCY);
+  if (desc.offset == ATTR_STD_NOT_FOUND) {
+    return true;
+  }
+
+  float3 P = sd->P;
+  object_inverse_position_transform(kg, sd, &P);
+  return kernel_tex_image_interp_3d(kg, desc.offset, P, INTERPOLATION_CLOSEST).x != 0.0f;
+}
+
 #endif
 
 CCL_NAMESPACE_END
@@ -840,6 +840,12 @@ ccl_device_inline void shader_eval_volume(KernelGlobals kg,
        * caching matrices instead of recomputing them each step */
       shader_setup_object_transforms(kg, sd, sd->time);
 #  endif
+
+      /* Skip empty space of volumes with an occupancy grid. It only exists for volumes that are
+       * set to skip empty space, because their shader gives no density or emission there. */
+      if (!volume_is_occupied(kg, sd)) {
+        continue;
+      }
     }
 
     /* evaluate shader */
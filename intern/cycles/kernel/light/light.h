@@ -18,6 +18,7 @@
 
 #include "kernel/geom/geom.h"
 #include "kernel/light/background.h"
+#include "kernel/light/tree.h"
 #include "kernel/sample/mapping.h"
 
 CCL_NAMESPACE_BEGIN
@@ -516,7 +517,12 @@ ccl_device bool light_sample_from_intersection(KernelGlobals kg,
     return false;
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  if (kernel_data.integrator.use_light_tree) {
+    ls->pdf *= light_tree_lamp_pdf(kg, ray_P, lamp);
+  }
+  else {
+    ls->pdf *= kernel_data.integrator.pdf_lights;
+  }
 
   return true;
 }
@@ -567,9 +573,9 @@ ccl_device_inline float triangle_light_pdf_area(KernelGlobals kg,
   return t * t * pdf / cos_pi;
 }
 
-ccl_device_forceinline float triangle_light_pdf(KernelGlobals kg,
-                                                ccl_private const ShaderData *sd,
-                                                float t)
+ccl_device_forceinline float triangle_light_pdf_distribution(KernelGlobals kg,
+                                                             ccl_private const ShaderData *sd,
+                                                             float t)
 {
   /* A naive heuristic to decide between costly solid angle sampling
    * and simple area sampling, comparing the distance to the triangle plane
@@ -638,6 +644,37 @@ ccl_device_forceinline float triangle_light_pdf(KernelGlobals kg,
   }
 }
 
+/* Factor to replace the selection probability of the flat light distribution in a triangle light
+ * pdf by the given one. */
+ccl_device_inline float triangle_light_pdf_select_scale(KernelGlobals kg,
+                                                       const int object,
+                                                       const int prim,
+                                                       const float select_pdf)
+{
+  /* The flat distribution selects triangles proportional to their area at the center frame. */
+  float3 V[3];
+  triangle_world_space_vertices(kg, object, prim, -1.0f, V);
+  const float distribution_pdf = triangle_area(V[0], V[1], V[2]) *
+                                 kernel_data.integrator.pdf_triangles;
+  return (distribution_pdf > 0.0f) ? select_pdf / distribution_pdf : 0.0f;
+}
+
+ccl_device_forceinline float triangle_light_pdf(KernelGlobals kg,
+                                                ccl_private const ShaderData *sd,
+                                                float t)
+{
+  const float pdf = triangle_light_pdf_distribution(kg, sd, t);
+
+  if (kernel_data.integrator.use_light_tree && pdf != 0.0f) {
+    /* Selection probability from the point the ray to the light started from. */
+    const float3 ray_P = sd->P + sd->I * t;
+    const float select_pdf = light_tree_triangle_pdf(kg, ray_P, sd->object, sd->prim);
+    return pdf * triangle_light_pdf_select_scale(kg, sd->object, sd->prim, select_pdf);
+  }
+
+  return pdf;
+}
+
 template<bool in_volume_segment>
 ccl_device_forceinline void triangle_light_sample(KernelGlobals kg,
                                                   int prim,
@@ -850,7 +887,14 @@ ccl_device_noinline bool light_distribution_sample(KernelGlobals kg,
                                                    ccl_private LightSample *ls)
 {
   /* Sample light index from distribution. */
-  const int index = light_distribution_sample(kg, &randu);
+  float select_pdf = 1.0f;
+  const int index = (kernel_data.integrator.use_light_tree) ?
+                        light_tree_distribution_sample(kg, P, &randu, &select_pdf) :
+                        light_distribution_sample(kg, &randu);
+  if (index < 0) {
+    return false;
+  }
+
   ccl_global const KernelLightDistribution *kdistribution = &kernel_tex_fetch(__light_distribution,
                                                                               index);
   const int prim = kdistribution->prim;
@@ -868,6 +912,9 @@ ccl_device_noinline bool light_distribution_sample(KernelGlobals kg,
     const int shader_flag = kdistribution->mesh_light.shader_flag;
     triangle_light_sample<in_volume_segment>(kg, prim, object, randu, randv, time, ls, P);
     ls->shader |= shader_flag;
+    if (kernel_data.integrator.use_light_tree) {
+      ls->pdf *= triangle_light_pdf_select_scale(kg, object, prim, select_pdf);
+    }
     return (ls->pdf > 0.0f);
   }
 
@@ -877,7 +924,17 @@ ccl_device_noinline bool light_distribution_sample(KernelGlobals kg,
     return false;
   }
 
-  return light_sample<in_volume_segment>(kg, lamp, randu, randv, P, path_flag, ls);
+  if (!light_sample<in_volume_segment>(kg, lamp, randu, randv, P, path_flag, ls)) {
+    return false;
+  }
+
+  if (kernel_data.integrator.use_light_tree &&
+      !(ls->type == LIGHT_DISTANT || ls->type == LIGHT_BACKGROUND)) {
+    /* Distant and background lights keep their probability from the flat distribution. */
+    ls->pdf *= select_pdf / kernel_data.integrator.pdf_lights;
+  }
+
+  return true;
 }
 
 ccl_device_inline bool light_distribution_sample_from_volume_segment(KernelGlobals kg,
@@ -911,13 +968,28 @@ ccl_device_inline bool light_distribution_sample_new_position(KernelGlobals kg,
                                                               const float3 P,
                                                               ccl_private LightSample *ls)
 {
-  /* Sample a new position on the same light, for volume sampling. */
+  /* Sample a new position on the same light, for volume sampling. With the light tree the
+   * selection probability depends on the position, so it is evaluated again for P. */
   if (ls->type == LIGHT_TRIANGLE) {
-    triangle_light_sample<false>(kg, ls->prim, ls->object, randu, randv, time, ls, P);
+    const int object = ls->object;
+    const int prim = ls->prim;
+    triangle_light_sample<false>(kg, prim, object, randu, randv, time, ls, P);
+    if (kernel_data.integrator.use_light_tree) {
+      const float select_pdf = light_tree_triangle_pdf(kg, P, object, prim);
+      ls->pdf *= triangle_light_pdf_select_scale(kg, object, prim, select_pdf);
+    }
     return (ls->pdf > 0.0f);
   }
   else {
-    return light_sample<false>(kg, ls->lamp, randu, randv, P, 0, ls);
+    const int lamp = ls->lamp;
+    if (!light_sample<false>(kg, lamp, randu, randv, P, 0, ls)) {
+      return false;
+    }
+    if (kernel_data.integrator.use_light_tree &&
+        !(ls->type == LIGHT_DISTANT || ls->type == LIGHT_BACKGROUND)) {
+      ls->pdf *= light_tree_lamp_pdf(kg, P, lamp) / kernel_data.integrator.pdf_lights;
+    }
+    return (ls->pdf > 0.0f);
   }
 }
 
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+CCL_NAMESPACE_BEGIN
+
+/* Light Tree
+ *
+ * Hierarchy over the local emitters of the light distribution, to select a light with a
+ * probability proportional to an estimate of its contribution to the shading point. Based on:
+ *
+ * Alejandro Conty Estevez and Christopher Kulla.
+ * Importance Sampling of Many Lights with Adaptive Tree Splitting.
+ *
+ * Distant and background lights are not part of the tree, they are selected with the same
+ * probability as in the flat light distribution. */
+
+/* Conservative estimate of the contribution of all emitters in a node to point P, using the
+ * bounding sphere of the node and its orientation cone. */
+ccl_device float light_tree_node_importance(KernelGlobals kg, const float3 P, const int node_index)
+{
+  ccl_global const KernelLightTreeNode *knode = &kernel_tex_fetch(__light_tree_nodes,
+                                                                  node_index);
+  if (knode->energy == 0.0f) {
+    return 0.0f;
+  }
+
+  const float3 bbox_min = make_float3(
+      knode->bounding_box_min[0], knode->bounding_box_min[1], knode->bounding_box_min[2]);
+  const float3 bbox_max = make_float3(
+      knode->bounding_box_max[0], knode->bounding_box_max[1], knode->bounding_box_max[2]);
+  const float3 centroid = 0.5f * (bbox_min + bbox_max);
+  const float radius = 0.5f * len(bbox_max - bbox_min);
+
+  float distance;
+  const float3 D = normalize_len(centroid - P, &distance);
+
+  /* Avoid the singularity close to the node, within its bounds emitters can be anywhere. */
+  const float distance_squared = max(sqr(distance), max(0.25f * sqr(radius), 1e-8f));
+  if (distance <= radius) {
+    return knode->energy / distance_squared;
+  }
+
+  /* Smallest angle between the emitter normals and the direction to P, taking into account the
+   * spread of the normals and the angle subtended by the bounding sphere. */
+  const float3 axis = make_float3(knode->axis[0], knode->axis[1], knode->axis[2]);
+  const float theta = safe_acosf(-dot(axis, D));
+  const float theta_u = safe_asinf(radius / distance);
+  const float theta_prime = max(theta - knode->theta_o - theta_u, 0.0f);
+
+  if (theta_prime >= knode->theta_e) {
+    return 0.0f;
+  }
+
+  return knode->energy * cosf(theta_prime) / distance_squared;
+}
+
+/* Walk down from the root, choosing between the children of each node in proportion to their
+ * importance. Returns the light distribution index of the selected emitter, or -1 when no
+ * emitter contributes to P. The random number is rescaled for reuse in sampling the emitter. */
+ccl_device int light_tree_sample(KernelGlobals kg,
+                                 const float3 P,
+                                 ccl_private float *randu,
+                                 ccl_private float *pdf)
+{
+  float r = *randu;
+  int node_index = 0;
+  *pdf = 1.0f;
+
+  while (true) {
+    const int child_index = kernel_tex_fetch(__light_tree_nodes, node_index).child_index;
+    if (child_index < 0) {
+      *randu = r;
+      return -1 - child_index;
+    }
+
+    const float importance_left = light_tree_node_importance(kg, P, node_index + 1);
+    const float importance_right = light_tree_node_importance(kg, P, child_index);
+    const float importance_total = importance_left + importance_right;
+    if (importance_total == 0.0f) {
+      return -1;
+    }
+
+    const float prob_left = importance_left / importance_total;
+    if (r < prob_left) {
+      r = r / prob_left;
+      *pdf *= prob_left;
+      node_index = node_index + 1;
+    }
+    else {
+      r = (r - prob_left) / (1.0f - prob_left);
+      *pdf *= 1.0f - prob_left;
+      node_index = child_index;
+    }
+  }
+}
+
+/* Probability of light_tree_sample() selecting the given leaf from P. */
+ccl_device float light_tree_pdf(KernelGlobals kg, const float3 P, int node_index)
+{
+  float pdf = 1.0f;
+  int parent_index = kernel_tex_fetch(__light_tree_nodes, node_index).parent_index;
+
+  while (parent_index >= 0) {
+    const int sibling_index = (node_index == parent_index + 1) ?
+                                  kernel_tex_fetch(__light_tree_nodes, parent_index).child_index :
+                                  parent_index + 1;
+    const float importance = light_tree_node_importance(kg, P, node_index);
+    if (importance == 0.0f) {
+      return 0.0f;
+    }
+    pdf *= importance / (importance + light_tree_node_importance(kg, P, sibling_index));
+
+    node_index = parent_index;
+    parent_index = kernel_tex_fetch(__light_tree_nodes, node_index).parent_index;
+  }
+
+  return pdf;
+}
+
+/* Select an emitter for P, either one of the distant lights or one from the tree. */
+ccl_device int light_tree_distribution_sample(KernelGlobals kg,
+                                              const float3 P,
+                                              ccl_private float *randu,
+                                              ccl_private float *pdf)
+{
+  const float distant_probability = kernel_data.integrator.light_tree_distant_probability;
+  const float r = *randu;
+
+  if (r < distant_probability) {
+    const int num_distant = kernel_data.integrator.num_light_tree_distant;
+    const float r_distant = r / distant_probability * num_distant;
+    const int distant_index = min((int)r_distant, num_distant - 1);
+    *randu = r_distant - distant_index;
+    *pdf = distant_probability / num_distant;
+    return kernel_tex_fetch(__light_tree_distant, distant_index);
+  }
+
+  *randu = (r - distant_probability) / (1.0f - distant_probability);
+  const int index = light_tree_sample(kg, P, randu, pdf);
+  *pdf *= 1.0f - distant_probability;
+  return index;
+}
+
+/* Probability of selecting the emitter in the given leaf from P. */
+ccl_device_inline float light_tree_leaf_pdf(KernelGlobals kg, const float3 P, const int leaf)
+{
+  if (leaf < 0) {
+    return 0.0f;
+  }
+  return (1.0f - kernel_data.integrator.light_tree_distant_probability) *
+         light_tree_pdf(kg, P, leaf);
+}
+
+ccl_device_inline float light_tree_lamp_pdf(KernelGlobals kg, const float3 P, const int lamp)
+{
+  return light_tree_leaf_pdf(kg, P, kernel_tex_fetch(__light_tree_lamp_leaf, lamp));
+}
+
+ccl_device_inline float light_tree_triangle_pdf(KernelGlobals kg,
+                                                const float3 P,
+                                                const int object,
+                                                const int prim)
+{
+  const int2 object_offset = kernel_tex_fetch(__light_tree_object_offset, object);
+  if (object_offset.x < 0) {
+    return 0.0f;
+  }
+  const int leaf = kernel_tex_fetch(__light_tree_triangle_leaf,
+                                    object_offset.x + prim - object_offset.y);
+  return light_tree_leaf_pdf(kg, P, leaf);
+}
+
+CCL_NAMESPACE_END
@@ -18,14 +18,15 @@
 
 CCL_NAMESPACE_BEGIN
 
-ccl_device float4 svm_image_texture(KernelGlobals kg, int id, float x, float y, uint flags)
+ccl_device float4 svm_image_texture_differentials(
+    KernelGlobals kg, int id, float x, float y, float2 dx, float2 dy, uint flags)
 {
   if (id == -1) {
     return make_float4(
         TEX_IMAGE_MISSING_R, TEX_IMAGE_MISSING_G, TEX_IMAGE_MISSING_B, TEX_IMAGE_MISSING_A);
   }
 
-  float4 r = kernel_tex_image_interp(kg, id, x, y);
+  float4 r = kernel_tex_image_interp_differentials(kg, id, x, y, dx, dy);
   const float alpha = r.w;
 
   if ((flags & NODE_IMAGE_ALPHA_UNASSOCIATE) && alpha != 1.0f && alpha != 0.0f) {
@@ -40,6 +41,27 @@ ccl_device float4 svm_image_texture(KernelGlobals kg, int id, float x, float y,
   return r;
 }
 
+ccl_device float4 svm_image_texture(KernelGlobals kg, int id, float x, float y, uint flags)
+{
+  return svm_image_texture_differentials(kg, id, x, y, zero_float2(), zero_float2(), flags);
+}
+
+#ifdef __KERNEL_CPU__
+/* Derivatives of the default UV map, as estimate of the footprint of the image lookup for
+ * mipmap selection in the texture cache. Texture coordinates are not differentiated through
+ * the shader graph, so this is only used for images mapped with that UV map unchanged. */
+ccl_device_inline void svm_image_texture_uv_differentials(KernelGlobals kg,
+                                                          ccl_private const ShaderData *sd,
+                                                          ccl_private float2 *dx,
+                                                          ccl_private float2 *dy)
+{
+  const AttributeDescriptor desc = find_attribute(kg, sd, ATTR_STD_UV);
+  if (desc.offset != ATTR_STD_NOT_FOUND) {
+    primitive_surface_attribute_float2(kg, sd, desc, dx, dy);
+  }
+}
+#endif
+
 /* Remap coordinate from 0..1 box to -1..-1 */
 ccl_device_inline float3 texco_remap_square(float3 co)
 {
@@ -110,7 +132,15 @@ ccl_device_noinline int svm_node_tex_image(
     id = -num_nodes;
   }
 
-  float4 f = svm_image_texture(kg, id, tex_co.x, tex_co.y, flags);
+  float2 dx = zero_float2(), dy = zero_float2();
+#ifdef __KERNEL_CPU__
+  if (id != -1 && (flags & NODE_IMAGE_USE_UV_DIFFERENTIALS) &&
+      kernel_tex_fetch(__texture_info, id).cache_image) {
+    svm_image_texture_uv_differentials(kg, sd, &dx, &dy);
+  }
+#endif
+
+  float4 f = svm_image_texture_differentials(kg, id, tex_co.x, tex_co.y, dx, dy, flags);
 
   if (stack_valid(out_offset))
     stack_store_float3(stack, out_offset, make_float3(f.x, f.y, f.z));
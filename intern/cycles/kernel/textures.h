@@ -72,6 +72,11 @@ KERNEL_TEX(KernelLightDistribution, __light_distribution)
 KERNEL_TEX(KernelLight, __lights)
 KERNEL_TEX(float2, __light_background_marginal_cdf)
 KERNEL_TEX(float2, __light_background_conditional_cdf)
+KERNEL_TEX(KernelLightTreeNode, __light_tree_nodes)
+KERNEL_TEX(int, __light_tree_lamp_leaf)
+KERNEL_TEX(int, __light_tree_triangle_leaf)
+KERNEL_TEX(int2, __light_tree_object_offset)
+KERNEL_TEX(int, __light_tree_distant)
 
 /* particles */
 KERNEL_TEX(KernelParticle, __particles)
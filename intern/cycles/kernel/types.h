@@ -625,6 +625,7 @@ typedef enum AttributeStandard {
   ATTR_STD_VOLUME_HEAT,
   ATTR_STD_VOLUME_TEMPERATURE,
   ATTR_STD_VOLUME_VELOCITY,
+  ATTR_STD_VOLUME_OCCUPANCY,
   ATTR_STD_POINTINESS,
   ATTR_STD_RANDOM_PER_ISLAND,
   ATTR_STD_SHADOW_TRANSPARENCY,
@@ -1222,6 +1223,14 @@ typedef struct KernelIntegrator {
   /* MIS debugging. */
   int direct_light_sampling_type;
 
+  /* light tree */
+  int use_light_tree;
+  int num_light_tree_distant;
+  float light_tree_distant_probability;
+
+  /* CPU wavefront with paths sorted by shader, read on the host only. */
+  int use_coherent_shading;
+
   /* padding */
   int pad1, pad2;
 } KernelIntegrator;
@@ -1412,6 +1421,24 @@ typedef struct KernelLightDistribution {
 } KernelLightDistribution;
 static_assert_align(KernelLightDistribution, 16);
 
+typedef struct KernelLightTreeNode {
+  /* Bounds of all emitters in the subtree, and their summed intensity. */
+  float bounding_box_min[3];
+  float energy;
+  float bounding_box_max[3];
+  /* Orientation cone: the emitter normals lie within theta_o around the axis, and each emitter
+   * emits within theta_e around its normal. */
+  float theta_o;
+  float axis[3];
+  float theta_e;
+  /* Inner nodes store the index of their second child, the first child directly follows the
+   * node. Leaves store the light distribution index of their emitter as -1 - index. */
+  int child_index;
+  int parent_index;
+  int pad1, pad2;
+} KernelLightTreeNode;
+static_assert_align(KernelLightTreeNode, 16);
+
 typedef struct KernelParticle {
   int index;
   float age;
@@ -765,13 +765,19 @@ void GeometryManager::device_update_attributes(Device *device,
     if (geom->is_hair() && static_cast<Hair *>(geom)->need_shadow_transparency()) {
       geom_attributes[i].add(ATTR_STD_SHADOW_TRANSPARENCY);
     }
+
+    if (geom->geometry_type == Geometry::VOLUME &&
+        static_cast<Volume *>(geom)->get_skip_empty_space()) {
+      geom_attributes[i].add(ATTR_STD_VOLUME_OCCUPANCY);
+    }
   }
 
   /* convert object attributes to use the same data structures as geometry ones */
   vector<AttributeRequestSet> object_attributes(scene->objects.size());
-  vector<AttributeSet> object_attribute_values;
 
-  object_attribute_values.reserve(scene->objects.size());
+  /* Values are only stored for objects that have attributes, in the order of the objects. Most
+   * objects, instances in particular, have none. */
+  vector<AttributeSet> object_attribute_values;
 
   for (size_t i = 0; i < scene->objects.size(); i++) {
     Object *object = scene->objects[i];
@@ -780,11 +786,9 @@ void GeometryManager::device_update_attributes(Device *device,
 
     assert(geom_idx < scene->geometry.size() && scene->geometry[geom_idx] == geom);
 
-    object_attribute_values.push_back(AttributeSet(geom, ATTR_PRIM_GEOMETRY));
-
     AttributeRequestSet &geom_requests = geom_attributes[geom_idx];
     AttributeRequestSet &attributes = object_attributes[i];
-    AttributeSet &values = object_attribute_values[i];
+    AttributeSet *values = NULL;
 
     for (size_t j = 0; j < object->attributes.size(); j++) {
       ParamValue &param = object->attributes[j];
@@ -793,7 +797,12 @@ void GeometryManager::device_update_attributes(Device *device,
       if (geom_requests.find(param.name()) && !geom->attributes.find(param.name())) {
         attributes.add(param.name());
 
-        Attribute *attr = values.add(param.name(), param.type(), ATTR_ELEMENT_OBJECT);
+        if (values == NULL) {
+          object_attribute_values.emplace_back(geom, ATTR_PRIM_GEOMETRY);
+          values = &object_attribute_values.back();
+        }
+
+        Attribute *attr = values->add(param.name(), param.type(), ATTR_ELEMENT_OBJECT);
         assert(param.datasize() == attr->buffer.size());
         memcpy(attr->buffer.data(), param.data(), param.datasize());
       }
@@ -813,9 +822,23 @@ void GeometryManager::device_update_attributes(Device *device,
   size_t attr_float4_size = 0;
   size_t attr_uchar4_size = 0;
 
+  /* Start of the attributes of each geometry in the arrays, so they can be filled in parallel. */
+  struct AttributeOffsets {
+    size_t attr_float;
+    size_t attr_float2;
+    size_t attr_float3;
+    size_t attr_float4;
+    size_t attr_uchar4;
+  };
+  vector<AttributeOffsets> geom_attribute_offsets(scene->geometry.size());
+
   for (size_t i = 0; i < scene->geometry.size(); i++) {
     Geometry *geom = scene->geometry[i];
     AttributeRequestSet &attributes = geom_attributes[i];
+
+    geom_attribute_offsets[i] = {
+        attr_float_size, attr_float2_size, attr_float3_size, attr_float4_size, attr_uchar4_size};
+
     foreach (AttributeRequest &req, attributes.requests) {
       Attribute *attr = geom->attributes.find(req);
 
@@ -844,11 +867,12 @@ void GeometryManager::device_update_attributes(Device *device,
     }
   }
 
-  for (size_t i = 0; i < scene->objects.size(); i++) {
-    Object *object = scene->objects[i];
+  const AttributeOffsets object_attribute_offsets = {
+      attr_float_size, attr_float2_size, attr_float3_size, attr_float4_size, attr_uchar4_size};
 
-    foreach (Attribute &attr, object_attribute_values[i].attributes) {
-      update_attribute_element_size(object->geometry,
+  foreach (AttributeSet &values, object_attribute_values) {
+    foreach (Attribute &attr, values.attributes) {
+      update_attribute_element_size(values.geometry,
                                     &attr,
                                     ATTR_PRIM_GEOMETRY,
                                     &attr_float_size,
@@ -874,17 +898,17 @@ void GeometryManager::device_update_attributes(Device *device,
       dscene->attributes_uchar4.need_realloc(),
   };
 
-  size_t attr_float_offset = 0;
-  size_t attr_float2_offset = 0;
-  size_t attr_float3_offset = 0;
-  size_t attr_float4_offset = 0;
-  size_t attr_uchar4_offset = 0;
-
-  /* Fill in attributes. */
-  for (size_t i = 0; i < scene->geometry.size(); i++) {
+  /* Fill in attributes. Only modified attributes are copied, unless the array was reallocated. */
+  parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
     Geometry *geom = scene->geometry[i];
     AttributeRequestSet &attributes = geom_attributes[i];
 
+    size_t attr_float_offset = geom_attribute_offsets[i].attr_float;
+    size_t attr_float2_offset = geom_attribute_offsets[i].attr_float2;
+    size_t attr_float3_offset = geom_attribute_offsets[i].attr_float3;
+    size_t attr_float4_offset = geom_attribute_offsets[i].attr_float4;
+    size_t attr_uchar4_offset = geom_attribute_offsets[i].attr_uchar4;
+
     /* todo: we now store std and name attributes from requests even if
      * they actually refer to the same mesh attributes, optimize */
     foreach (AttributeRequest &req, attributes.requests) {
@@ -936,16 +960,27 @@ void GeometryManager::device_update_attributes(Device *device,
                                         req.subd_type,
                                         req.subd_desc);
       }
-
-      if (progress.get_cancel())
-        return;
     }
-  }
+  });
+
+  if (progress.get_cancel())
+    return;
+
+  size_t attr_float_offset = object_attribute_offsets.attr_float;
+  size_t attr_float2_offset = object_attribute_offsets.attr_float2;
+  size_t attr_float3_offset = object_attribute_offsets.attr_float3;
+  size_t attr_float4_offset = object_attribute_offsets.attr_float4;
+  size_t attr_uchar4_offset = object_attribute_offsets.attr_uchar4;
+  size_t object_values_index = 0;
 
   for (size_t i = 0; i < scene->objects.size(); i++) {
     Object *object = scene->objects[i];
     AttributeRequestSet &attributes = object_attributes[i];
-    AttributeSet &values = object_attribute_values[i];
+    if (attributes.size() == 0) {
+      continue;
+    }
+
+    AttributeSet &values = object_attribute_values[object_values_index++];
 
     foreach (AttributeRequest &req, attributes.requests) {
       Attribute *attr = values.find(req);
@@ -1150,31 +1185,36 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->tri_patch.need_realloc() ||
                                dscene->tri_patch_uv.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
-        Mesh *mesh = static_cast<Mesh *>(geom);
+    /* Meshes are packed in parallel, each into its own range of the arrays as computed by
+     * geom_calc_offset(). Only modified meshes are packed again, unless reallocated. */
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (geom->geometry_type != Geometry::MESH && geom->geometry_type != Geometry::VOLUME) {
+        return;
+      }
 
-        if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
-            mesh->triangles_is_modified() || copy_all_data) {
-          mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
-        }
+      Mesh *mesh = static_cast<Mesh *>(geom);
 
-        if (mesh->verts_is_modified() || copy_all_data) {
-          mesh->pack_normals(&vnormal[mesh->vert_offset]);
-        }
+      if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
+          mesh->triangles_is_modified() || copy_all_data) {
+        mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+      }
 
-        if (mesh->verts_is_modified() || mesh->triangles_is_modified() ||
-            mesh->vert_patch_uv_is_modified() || copy_all_data) {
-          mesh->pack_verts(&tri_verts[mesh->prim_offset * 3],
-                           &tri_vindex[mesh->prim_offset],
-                           &tri_patch[mesh->prim_offset],
-                           &tri_patch_uv[mesh->vert_offset]);
-        }
+      if (mesh->verts_is_modified() || copy_all_data) {
+        mesh->pack_normals(&vnormal[mesh->vert_offset]);
+      }
 
-        if (progress.get_cancel())
-          return;
+      if (mesh->verts_is_modified() || mesh->triangles_is_modified() ||
+          mesh->vert_patch_uv_is_modified() || copy_all_data) {
+        mesh->pack_verts(&tri_verts[mesh->prim_offset * 3],
+                         &tri_vindex[mesh->prim_offset],
+                         &tri_patch[mesh->prim_offset],
+                         &tri_patch_uv[mesh->vert_offset]);
       }
-    }
+    });
+
+    if (progress.get_cancel())
+      return;
 
     /* vertex coordinates */
     progress.set_status("Updating Mesh", "Copying Mesh to device");
@@ -1198,27 +1238,31 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->curves.need_realloc() ||
                                dscene->curve_segments.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_hair()) {
-        Hair *hair = static_cast<Hair *>(geom);
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (!geom->is_hair()) {
+        return;
+      }
 
-        bool curve_keys_co_modified = hair->curve_radius_is_modified() ||
-                                      hair->curve_keys_is_modified();
-        bool curve_data_modified = hair->curve_shader_is_modified() ||
-                                   hair->curve_first_key_is_modified();
+      Hair *hair = static_cast<Hair *>(geom);
 
-        if (!curve_keys_co_modified && !curve_data_modified && !copy_all_data) {
-          continue;
-        }
+      bool curve_keys_co_modified = hair->curve_radius_is_modified() ||
+                                    hair->curve_keys_is_modified();
+      bool curve_data_modified = hair->curve_shader_is_modified() ||
+                                 hair->curve_first_key_is_modified();
 
-        hair->pack_curves(scene,
-                          &curve_keys[hair->curve_key_offset],
-                          &curves[hair->prim_offset],
-                          &curve_segments[hair->curve_segment_offset]);
-        if (progress.get_cancel())
-          return;
+      if (!curve_keys_co_modified && !curve_data_modified && !copy_all_data) {
+        return;
       }
-    }
+
+      hair->pack_curves(scene,
+                        &curve_keys[hair->curve_key_offset],
+                        &curves[hair->prim_offset],
+                        &curve_segments[hair->curve_segment_offset]);
+    });
+
+    if (progress.get_cancel())
+      return;
 
     dscene->curve_keys.copy_to_device_if_modified();
     dscene->curves.copy_to_device_if_modified();
@@ -1231,18 +1275,31 @@ void GeometryManager::device_update_mesh(Device *,
     float4 *points = dscene->points.alloc(point_size);
     uint *points_shader = dscene->points_shader.alloc(point_size);
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_pointcloud()) {
-        PointCloud *pointcloud = static_cast<PointCloud *>(geom);
-        pointcloud->pack(
-            scene, &points[pointcloud->prim_offset], &points_shader[pointcloud->prim_offset]);
-        if (progress.get_cancel())
-          return;
+    const bool copy_all_data = dscene->points.need_realloc() ||
+                               dscene->points_shader.need_realloc();
+
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (!geom->is_pointcloud()) {
+        return;
       }
-    }
 
-    dscene->points.copy_to_device();
-    dscene->points_shader.copy_to_device();
+      PointCloud *pointcloud = static_cast<PointCloud *>(geom);
+
+      if (!pointcloud->points_is_modified() && !pointcloud->radius_is_modified() &&
+          !pointcloud->shader_is_modified() && !copy_all_data) {
+        return;
+      }
+
+      pointcloud->pack(
+          scene, &points[pointcloud->prim_offset], &points_shader[pointcloud->prim_offset]);
+    });
+
+    if (progress.get_cancel())
+      return;
+
+    dscene->points.copy_to_device_if_modified();
+    dscene->points_shader.copy_to_device_if_modified();
   }
 
   if (patch_size != 0 && dscene->patches.need_realloc()) {
@@ -1250,20 +1307,23 @@ void GeometryManager::device_update_mesh(Device *,
 
     uint *patch_data = dscene->patches.alloc(patch_size);
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_mesh()) {
-        Mesh *mesh = static_cast<Mesh *>(geom);
-        mesh->pack_patches(&patch_data[mesh->patch_offset]);
+    parallel_for(size_t(0), scene->geometry.size(), [&](const size_t i) {
+      Geometry *geom = scene->geometry[i];
+      if (!geom->is_mesh()) {
+        return;
+      }
 
-        if (mesh->patch_table) {
-          mesh->patch_table->copy_adjusting_offsets(&patch_data[mesh->patch_table_offset],
-                                                    mesh->patch_table_offset);
-        }
+      Mesh *mesh = static_cast<Mesh *>(geom);
+      mesh->pack_patches(&patch_data[mesh->patch_offset]);
 
-        if (progress.get_cancel())
-          return;
+      if (mesh->patch_table) {
+        mesh->patch_table->copy_adjusting_offsets(&patch_data[mesh->patch_table_offset],
+                                                  mesh->patch_table_offset);
       }
-    }
+    });
+
+    if (progress.get_cancel())
+      return;
 
     dscene->patches.copy_to_device();
   }
@@ -1549,7 +1609,7 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
       }
 
       Volume *volume = static_cast<Volume *>(geom);
-      create_volume_mesh(volume, progress);
+      create_volume_mesh(scene, volume, progress);
 
       /* always reallocate when we have a volume, as we need to rebuild the BVH */
       device_update_flags |= DEVICE_MESH_DATA_NEEDS_REALLOC;
@@ -2026,21 +2086,40 @@ void GeometryManager::device_update(Device *device,
     });
     TaskPool pool;
 
+    /* Count how many geometry BVHs are built, refit or reused unchanged from a previous
+     * update, to report how effective persistent BVHs are. */
+    size_t num_bvh_built = 0;
+    size_t num_bvh_refit = 0;
+    size_t num_bvh_reused = 0;
+
     size_t i = 0;
     foreach (Geometry *geom, scene->geometry) {
       if (geom->is_modified() || geom->need_update_bvh_for_offset) {
         need_update_scene_bvh = true;
+        if (geom->need_build_bvh(bvh_layout)) {
+          if (geom->bvh && !geom->need_update_rebuild) {
+            num_bvh_refit++;
+          }
+          else {
+            num_bvh_built++;
+          }
+        }
         pool.push(function_bind(
             &Geometry::compute_bvh, geom, device, dscene, &scene->params, &progress, i, num_bvh));
         if (geom->need_build_bvh(bvh_layout)) {
           i++;
         }
       }
+      else if (geom->bvh) {
+        num_bvh_reused++;
+      }
     }
 
     TaskPool::Summary summary;
     pool.wait_work(&summary);
     VLOG(2) << "Objects BVH build pool statistics:\n" << summary.full_report();
+    VLOG(1) << "Object BVHs: " << num_bvh_built << " built, " << num_bvh_refit << " refit, "
+            << num_bvh_reused << " reused.";
   }
 
   foreach (Shader *shader, scene->shaders) {
@@ -17,6 +17,7 @@
 #include "scene/image.h"
 #include "device/device.h"
 #include "scene/colorspace.h"
+#include "scene/image_cache.h"
 #include "scene/image_oiio.h"
 #include "scene/image_vdb.h"
 #include "scene/scene.h"
@@ -300,6 +301,7 @@ ImageManager::ImageManager(const DeviceInfo &info)
 {
   need_update_ = true;
   osl_texture_system = NULL;
+  image_cache = NULL;
   animation_frame = 0;
 
   /* Set image limits */
@@ -310,6 +312,13 @@ ImageManager::~ImageManager()
 {
   for (size_t slot = 0; slot < images.size(); slot++)
     assert(!images[slot]);
+
+  delete image_cache;
+}
+
+bool ImageManager::device_has_nanovdb() const
+{
+  return features.has_nanovdb;
 }
 
 void ImageManager::set_osl_texture_system(void *texture_system)
@@ -317,6 +326,12 @@ void ImageManager::set_osl_texture_system(void *texture_system)
   osl_texture_system = texture_system;
 }
 
+void ImageManager::set_texture_cache(int max_memory_MB)
+{
+  assert(images.empty());
+  image_cache = new ImageCache(max_memory_MB);
+}
+
 bool ImageManager::set_animation_frame_update(int frame)
 {
   if (frame != animation_frame) {
@@ -356,6 +371,12 @@ void ImageManager::load_image_metadata(Image *img)
 
   metadata.detect_colorspace();
 
+  img->use_cache = use_image_cache(img);
+  if (img->use_cache && metadata.colorspace != u_colorspace_srgb) {
+    /* The texture cache converts to scene linear on lookup, only sRGB is left to the kernel. */
+    metadata.compress_as_srgb = false;
+  }
+
   assert(features.has_nanovdb || (metadata.type != IMAGE_DATA_TYPE_NANOVDB_FLOAT ||
                                   metadata.type != IMAGE_DATA_TYPE_NANOVDB_FLOAT3));
 
@@ -448,6 +469,8 @@ int ImageManager::add_image_slot(ImageLoader *loader,
   img->builtin = builtin;
   img->users = 1;
   img->mem = NULL;
+  img->use_cache = false;
+  img->cache_image = NULL;
 
   images[slot] = img;
 
@@ -490,6 +513,25 @@ static bool image_associate_alpha(ImageManager::Image *img)
            img->params.alpha_type == IMAGE_ALPHA_CHANNEL_PACKED);
 }
 
+bool ImageManager::use_image_cache(Image *img)
+{
+  /* Only 2D image files, OSL has its own texture cache. */
+  if (image_cache == NULL || osl_texture_system || img->loader->osl_filepath().empty()) {
+    return false;
+  }
+
+  const ImageMetaData &metadata = img->metadata;
+  if (metadata.depth > 1 || metadata.type == IMAGE_DATA_TYPE_NANOVDB_FLOAT ||
+      metadata.type == IMAGE_DATA_TYPE_NANOVDB_FLOAT3) {
+    return false;
+  }
+
+  /* The texture cache always associates alpha, images with alpha channel that should be left
+   * untouched are loaded into memory. */
+  const bool has_alpha = (metadata.channels == 2 || metadata.channels == 4);
+  return !has_alpha || image_associate_alpha(img);
+}
+
 template<TypeDesc::BASETYPE FileFormat, typename StorageType>
 bool ImageManager::file_load_image(Image *img, int texture_limit)
 {
@@ -676,6 +718,29 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
   img->mem->info.use_transform_3d = img->metadata.use_transform_3d;
   img->mem->info.transform_3d = img->metadata.transform_3d;
 
+  if (img->use_cache) {
+    /* Tiles are read from the file again, in case it changed. */
+    if (img->cache_image) {
+      image_cache->remove_image(img->cache_image);
+    }
+    img->cache_image = image_cache->add_image(
+        img->loader->osl_filepath(), img->metadata, img->params);
+  }
+
+  if (img->cache_image) {
+    /* Pixels are looked up in the texture cache while rendering, only a placeholder pixel is
+     * stored in device memory. */
+    thread_scoped_lock device_lock(device_mutex);
+    img->mem->info.cache_image = (uint64_t)img->cache_image;
+    void *pixels = img->mem->alloc(1, 1);
+    memset(pixels, 0, img->mem->memory_size());
+    img->mem->copy_to_device();
+
+    img->loader->cleanup();
+    img->need_load = false;
+    return;
+  }
+
   /* Create new texture. */
   if (type == IMAGE_DATA_TYPE_FLOAT4) {
     if (!file_load_image<TypeDesc::FLOAT, float>(img, texture_limit)) {
@@ -803,6 +868,10 @@ void ImageManager::device_free_image(Device *, int slot)
     delete img->mem;
   }
 
+  if (img->cache_image) {
+    image_cache->remove_image(img->cache_image);
+  }
+
   delete img->loader;
   delete img;
   images[slot] = NULL;
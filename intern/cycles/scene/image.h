@@ -34,6 +34,7 @@ class DeviceInfo;
 class ImageHandle;
 class ImageKey;
 class ImageMetaData;
+class ImageCache;
 class ImageManager;
 class Progress;
 class RenderStats;
@@ -191,10 +192,13 @@ class ImageManager {
   void device_free_builtin(Device *device);
 
   void set_osl_texture_system(void *texture_system);
+  void set_texture_cache(int max_memory_MB);
   bool set_animation_frame_update(int frame);
 
   void collect_statistics(RenderStats *stats);
 
+  bool device_has_nanovdb() const;
+
   void tag_update();
 
   bool need_update() const;
@@ -212,6 +216,10 @@ class ImageManager {
     string mem_name;
     device_texture *mem;
 
+    /* Sampled through the texture cache instead of loaded into memory. */
+    bool use_cache;
+    TextureCacheImage *cache_image;
+
     int users;
     thread_mutex mutex;
   };
@@ -227,12 +235,14 @@ class ImageManager {
 
   vector<Image *> images;
   void *osl_texture_system;
+  ImageCache *image_cache;
 
   int add_image_slot(ImageLoader *loader, const ImageParams &params, const bool builtin);
   void add_image_user(int slot);
   void remove_image_user(int slot);
 
   void load_image_metadata(Image *img);
+  bool use_image_cache(Image *img);
 
   template<TypeDesc::BASETYPE FileFormat, typename StorageType>
   bool file_load_image(Image *img, int texture_limit);
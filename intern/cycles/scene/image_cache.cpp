@@ -0,0 +1,142 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scene/image_cache.h"
+#include "scene/colorspace.h"
+
+#include "util/log.h"
+#include "util/math.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Image in the texture system, with the lookup options and color space conversion matching the
+ * image when it is loaded into memory. */
+class ImageCacheTexture : public TextureCacheImage {
+ public:
+  ImageCacheTexture(OIIO::TextureSystem *texture_system,
+                    OIIO::TextureSystem::TextureHandle *handle,
+                    ustring filepath,
+                    const ImageMetaData &metadata,
+                    const ImageParams &params)
+      : texture_system(texture_system), handle(handle), filepath(filepath), processor(NULL)
+  {
+    switch (params.extension) {
+      case EXTENSION_REPEAT:
+        options.swrap = options.twrap = OIIO::TextureOpt::WrapPeriodic;
+        break;
+      case EXTENSION_CLIP:
+        options.swrap = options.twrap = OIIO::TextureOpt::WrapBlack;
+        break;
+      default:
+        options.swrap = options.twrap = OIIO::TextureOpt::WrapClamp;
+        break;
+    }
+
+    switch (params.interpolation) {
+      case INTERPOLATION_CLOSEST:
+        options.interpmode = OIIO::TextureOpt::InterpClosest;
+        options.mipmode = OIIO::TextureOpt::MipModeOneLevel;
+        break;
+      case INTERPOLATION_CUBIC:
+      case INTERPOLATION_SMART:
+        options.interpmode = OIIO::TextureOpt::InterpBicubic;
+        break;
+      default:
+        options.interpmode = OIIO::TextureOpt::InterpBilinear;
+        break;
+    }
+
+    /* Opaque alpha for images without alpha channel. */
+    options.fill = 1.0f;
+
+    /* sRGB is converted to linear in the kernel, same as for images in memory. */
+    if (metadata.colorspace != u_colorspace_raw && metadata.colorspace != u_colorspace_srgb) {
+      processor = ColorSpaceManager::get_processor(metadata.colorspace);
+    }
+  }
+
+  float4 lookup(float x, float y, float dsdx, float dtdx, float dsdy, float dtdy) const override
+  {
+    /* Rows of images in memory are stored bottom to top, OpenImageIO uses top to bottom. */
+    OIIO::TextureOpt opt = options;
+    float result[4];
+
+    if (!texture_system->texture(
+            handle, NULL, opt, x, 1.0f - y, dsdx, -dtdx, dsdy, -dtdy, 4, result)) {
+      /* Clear error to avoid it accumulating. */
+      texture_system->geterror();
+      return make_float4(
+          TEX_IMAGE_MISSING_R, TEX_IMAGE_MISSING_G, TEX_IMAGE_MISSING_B, TEX_IMAGE_MISSING_A);
+    }
+
+    if (processor) {
+      ColorSpaceManager::to_scene_linear(processor, result, 4);
+    }
+
+    const float4 r = make_float4(result[0], result[1], result[2], result[3]);
+    return isfinite4_safe(r) ? r : zero_float4();
+  }
+
+  OIIO::TextureSystem *texture_system;
+  OIIO::TextureSystem::TextureHandle *handle;
+  ustring filepath;
+  OIIO::TextureOpt options;
+  ColorSpaceProcessor *processor;
+};
+
+ImageCache::ImageCache(int max_memory_MB)
+{
+  /* Own image cache rather than the shared one, so the memory limit applies to this scene. */
+  texture_system = OIIO::TextureSystem::create(false);
+
+  texture_system->attribute("automip", 1);
+  texture_system->attribute("autotile", 64);
+  texture_system->attribute("gray_to_rgb", 1);
+  texture_system->attribute("max_memory_MB", (float)max_memory_MB);
+
+  VLOG(1) << "Texture cache created with " << max_memory_MB << " MB memory limit.";
+}
+
+ImageCache::~ImageCache()
+{
+  VLOG(2) << "Texture cache statistics:\n" << texture_system->getstats();
+
+  OIIO::TextureSystem::destroy(texture_system, true);
+}
+
+TextureCacheImage *ImageCache::add_image(ustring filepath,
+                                         const ImageMetaData &metadata,
+                                         const ImageParams &params)
+{
+  OIIO::TextureSystem::TextureHandle *handle = texture_system->get_texture_handle(filepath);
+
+  if (handle == NULL || !texture_system->good(handle)) {
+    texture_system->geterror();
+    return NULL;
+  }
+
+  return new ImageCacheTexture(texture_system, handle, filepath, metadata, params);
+}
+
+void ImageCache::remove_image(TextureCacheImage *image)
+{
+  /* Drop tiles from the cache, the file may have changed when the image is loaded again. */
+  ImageCacheTexture *cache_image = (ImageCacheTexture *)image;
+  texture_system->invalidate(cache_image->filepath);
+  delete cache_image;
+}
+
+CCL_NAMESPACE_END
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __IMAGE_CACHE_H__
+#define __IMAGE_CACHE_H__
+
+#include <OpenImageIO/texture.h>
+
+#include "scene/image.h"
+
+#include "util/texture.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Image Cache
+ *
+ * Image files sampled by the CPU kernel through an OpenImageIO texture system, instead of being
+ * loaded fully into memory before rendering. Tiles are read on demand while rendering and kept
+ * in a cache of limited size, evicting tiles that were not used recently when it is full.
+ * Tiled and mipmapped files such as .tx are used as is, for other files tiles and mipmap levels
+ * are generated when they are first accessed. */
+class ImageCache {
+ public:
+  explicit ImageCache(int max_memory_MB);
+  ~ImageCache();
+
+  /* Returns NULL if the file can not be read, the image must then be loaded without cache. */
+  TextureCacheImage *add_image(ustring filepath,
+                               const ImageMetaData &metadata,
+                               const ImageParams &params);
+  void remove_image(TextureCacheImage *image);
+
+ protected:
+  OIIO::TextureSystem *texture_system;
+};
+
+CCL_NAMESPACE_END
+
+#endif /* __IMAGE_CACHE_H__ */
@@ -20,6 +20,7 @@
 #include "scene/film.h"
 #include "scene/integrator.h"
 #include "scene/light.h"
+#include "scene/light_tree.h"
 #include "scene/mesh.h"
 #include "scene/object.h"
 #include "scene/scene.h"
@@ -33,6 +34,7 @@
 #include "util/foreach.h"
 #include "util/hash.h"
 #include "util/log.h"
+#include "util/map.h"
 #include "util/path.h"
 #include "util/progress.h"
 #include "util/task.h"
@@ -527,6 +529,213 @@ void LightManager::device_update_distribution(Device *,
   }
 }
 
+void LightManager::device_update_tree(Device *,
+                                      DeviceScene *dscene,
+                                      Scene *scene,
+                                      Progress &progress)
+{
+  KernelIntegrator *kintegrator = &dscene->data.integrator;
+  kintegrator->use_light_tree = false;
+  kintegrator->num_light_tree_distant = 0;
+  kintegrator->light_tree_distant_probability = 0.0f;
+
+  if (!scene->integrator->get_use_light_tree() || !kintegrator->use_direct_light) {
+    return;
+  }
+
+  progress.set_status("Updating Lights", "Building light tree");
+
+  /* Gather the emitters in the same order as the light distribution. */
+  vector<LightTreePrimitive> prims;
+  int distribution_index = 0;
+
+  /* Index of each emissive triangle in the triangle lookup table, which has a slot for every
+   * triangle of the meshes used as light. */
+  vector<int> triangle_slots;
+  vector<int2> object_offsets(scene->objects.size(), make_int2(-1, 0));
+  int num_triangle_slots = 0;
+
+  /* Shaders with emission that is not constant are assumed to be of unit strength. */
+  unordered_map<Shader *, float> shader_emission;
+
+  int object_id = 0;
+  foreach (Object *object, scene->objects) {
+    if (progress.get_cancel())
+      return;
+
+    if (!object_usable_as_light(object)) {
+      object_id++;
+      continue;
+    }
+
+    Mesh *mesh = static_cast<Mesh *>(object->get_geometry());
+    const bool transform_applied = mesh->transform_applied;
+    const Transform tfm = object->get_tfm();
+    const size_t mesh_num_triangles = mesh->num_triangles();
+    object_offsets[object_id] = make_int2(num_triangle_slots, mesh->prim_offset);
+
+    for (size_t i = 0; i < mesh_num_triangles; i++) {
+      int shader_index = mesh->get_shader()[i];
+      Shader *shader = (shader_index < mesh->get_used_shaders().size()) ?
+                           static_cast<Shader *>(mesh->get_used_shaders()[shader_index]) :
+                           scene->default_surface;
+
+      if (!(shader->get_use_mis() && shader->has_surface_emission)) {
+        continue;
+      }
+
+      triangle_slots.push_back(num_triangle_slots + i);
+      const int index = distribution_index++;
+
+      Mesh::Triangle t = mesh->get_triangle(i);
+      if (!t.valid(&mesh->get_verts()[0])) {
+        continue;
+      }
+      float3 p1 = mesh->get_verts()[t.v[0]];
+      float3 p2 = mesh->get_verts()[t.v[1]];
+      float3 p3 = mesh->get_verts()[t.v[2]];
+
+      if (!transform_applied) {
+        p1 = transform_point(&tfm, p1);
+        p2 = transform_point(&tfm, p2);
+        p3 = transform_point(&tfm, p3);
+      }
+
+      auto emission_it = shader_emission.find(shader);
+      if (emission_it == shader_emission.end()) {
+        float3 emission;
+        const float strength = shader->is_constant_emission(&emission) ?
+                                   average(fabs(emission)) :
+                                   1.0f;
+        emission_it = shader_emission.insert({shader, strength}).first;
+      }
+
+      const float energy = triangle_area(p1, p2, p3) * emission_it->second;
+      if (!(energy > 0.0f)) {
+        continue;
+      }
+
+      LightTreePrimitive prim;
+      prim.bbox = BoundBox::empty;
+      prim.bbox.grow(p1);
+      prim.bbox.grow(p2);
+      prim.bbox.grow(p3);
+      /* Mesh lights emit from both sides. */
+      prim.cone = LightTreeCone(safe_normalize(cross(p2 - p1, p3 - p1)), M_PI_F, M_PI_2_F);
+      prim.energy = energy;
+      prim.distribution_index = index;
+      prims.push_back(prim);
+    }
+
+    num_triangle_slots += mesh_num_triangles;
+    object_id++;
+  }
+
+  const int num_triangles = distribution_index;
+  int num_lights = 0;
+  vector<int> distant;
+
+  foreach (Light *light, scene->lights) {
+    if (!light->is_enabled)
+      continue;
+
+    const int index = distribution_index++;
+    num_lights++;
+
+    LightTreePrimitive prim;
+    prim.bbox = BoundBox::empty;
+    prim.distribution_index = index;
+
+    /* Energy is the radiant intensity in the direction of the cone axis. */
+    const float power = average(fabs(light->strength));
+
+    if (light->light_type == LIGHT_POINT) {
+      prim.bbox.grow(light->co, light->size);
+      prim.cone = LightTreeCone(make_float3(0.0f, 0.0f, 1.0f), M_PI_F, M_PI_2_F);
+      prim.energy = power * M_1_PI_F * 0.25f;
+    }
+    else if (light->light_type == LIGHT_SPOT) {
+      prim.bbox.grow(light->co, light->size);
+      prim.cone = LightTreeCone(
+          safe_normalize(light->dir), 0.0f, min(light->spot_angle * 0.5f, M_PI_2_F));
+      prim.energy = power * M_1_PI_F * 0.25f;
+    }
+    else if (light->light_type == LIGHT_AREA) {
+      const float3 axisu = light->axisu * (light->sizeu * light->size * 0.5f);
+      const float3 axisv = light->axisv * (light->sizev * light->size * 0.5f);
+      prim.bbox.grow(light->co + axisu + axisv);
+      prim.bbox.grow(light->co + axisu - axisv);
+      prim.bbox.grow(light->co - axisu + axisv);
+      prim.bbox.grow(light->co - axisu - axisv);
+      const float min_spread_angle = 1.0f * M_PI_F / 180.0f;
+      const float spread_angle = 0.5f * max(light->spread, min_spread_angle);
+      prim.cone = LightTreeCone(safe_normalize(light->dir), 0.0f, min(spread_angle, M_PI_2_F));
+      prim.energy = power * 0.25f;
+    }
+    else {
+      /* Distant and background lights have no position to build a hierarchy from. */
+      distant.push_back(index);
+      continue;
+    }
+
+    if (prim.energy > 0.0f) {
+      prims.push_back(prim);
+    }
+  }
+
+  if (prims.empty()) {
+    return;
+  }
+
+  LightTree tree(prims);
+  const vector<KernelLightTreeNode> &nodes = tree.get_nodes();
+  const vector<int> &leaves = tree.get_leaves();
+
+  VLOG(1) << "Light tree with " << nodes.size() << " nodes for " << prims.size()
+          << " emitters.";
+
+  KernelLightTreeNode *knodes = dscene->light_tree_nodes.alloc(nodes.size());
+  std::copy(nodes.begin(), nodes.end(), knodes);
+
+  /* Lookup of the leaf of each emitter, for the pdf of lights hit by rays. Emitters without leaf
+   * can not be selected by the tree. */
+  int *lamp_leaf = dscene->light_tree_lamp_leaf.alloc(max(num_lights, 1));
+  std::fill(lamp_leaf, lamp_leaf + max(num_lights, 1), -1);
+  int *triangle_leaf = dscene->light_tree_triangle_leaf.alloc(max(num_triangle_slots, 1));
+  std::fill(triangle_leaf, triangle_leaf + max(num_triangle_slots, 1), -1);
+
+  for (size_t i = 0; i < prims.size(); i++) {
+    const int index = prims[i].distribution_index;
+    if (index < num_triangles) {
+      triangle_leaf[triangle_slots[index]] = leaves[i];
+    }
+    else {
+      lamp_leaf[index - num_triangles] = leaves[i];
+    }
+  }
+
+  int2 *object_offset = dscene->light_tree_object_offset.alloc(max(object_offsets.size(),
+                                                                   (size_t)1));
+  object_offset[0] = make_int2(-1, 0);
+  std::copy(object_offsets.begin(), object_offsets.end(), object_offset);
+
+  int *kdistant = dscene->light_tree_distant.alloc(max(distant.size(), (size_t)1));
+  kdistant[0] = 0;
+  std::copy(distant.begin(), distant.end(), kdistant);
+
+  dscene->light_tree_nodes.copy_to_device();
+  dscene->light_tree_lamp_leaf.copy_to_device();
+  dscene->light_tree_triangle_leaf.copy_to_device();
+  dscene->light_tree_object_offset.copy_to_device();
+  dscene->light_tree_distant.copy_to_device();
+
+  /* Distant lights keep the probability they have in the flat distribution. */
+  kintegrator->use_light_tree = true;
+  kintegrator->num_light_tree_distant = distant.size();
+  kintegrator->light_tree_distant_probability = min(distant.size() * kintegrator->pdf_lights,
+                                                    1.0f);
+}
+
 static void background_cdf(
     int start, int end, int res_x, int res_y, const vector<float3> *pixels, float2 *cond_cdf)
 {
@@ -992,6 +1201,10 @@ void LightManager::device_update(Device *device,
   if (progress.get_cancel())
     return;
 
+  device_update_tree(device, dscene, scene, progress);
+  if (progress.get_cancel())
+    return;
+
   if (need_update_background) {
     device_update_background(device, dscene, scene, progress);
     if (progress.get_cancel())
@@ -1009,6 +1222,11 @@ void LightManager::device_update(Device *device,
 void LightManager::device_free(Device *, DeviceScene *dscene, const bool free_background)
 {
   dscene->light_distribution.free();
+  dscene->light_tree_nodes.free();
+  dscene->light_tree_lamp_leaf.free();
+  dscene->light_tree_triangle_leaf.free();
+  dscene->light_tree_object_offset.free();
+  dscene->light_tree_distant.free();
   dscene->lights.free();
   if (free_background) {
     dscene->light_background_marginal_cdf.free();
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scene/light_tree.h"
+
+#include "util/algorithm.h"
+#include "util/math.h"
+
+CCL_NAMESPACE_BEGIN
+
+LightTreeCone LightTreeCone::merge(const LightTreeCone &a, const LightTreeCone &b)
+{
+  if (a.theta_o < b.theta_o) {
+    return merge(b, a);
+  }
+
+  const float theta_e = max(a.theta_e, b.theta_e);
+  const float cos_theta_d = dot(a.axis, b.axis);
+  const float theta_d = safe_acosf(cos_theta_d);
+
+  /* Cone of b is contained in the cone of a. */
+  if (min(theta_d + b.theta_o, M_PI_F) <= a.theta_o) {
+    return LightTreeCone(a.axis, a.theta_o, theta_e);
+  }
+
+  const float theta_o = 0.5f * (a.theta_o + theta_d + b.theta_o);
+  const float3 ortho = b.axis - a.axis * cos_theta_d;
+  if (theta_o >= M_PI_F || len_squared(ortho) == 0.0f) {
+    return LightTreeCone(a.axis, M_PI_F, theta_e);
+  }
+
+  /* Rotate the axis of a towards b, so the new cone just contains both. */
+  const float theta_r = theta_o - a.theta_o;
+  const float3 axis = a.axis * cosf(theta_r) + normalize(ortho) * sinf(theta_r);
+  return LightTreeCone(normalize(axis), theta_o, theta_e);
+}
+
+LightTree::LightTree(const vector<LightTreePrimitive> &prims)
+{
+  const int num_prims = prims.size();
+  if (num_prims == 0) {
+    return;
+  }
+
+  order_.resize(num_prims);
+  for (int i = 0; i < num_prims; i++) {
+    order_[i] = i;
+  }
+  leaves_.resize(num_prims, -1);
+  nodes_.reserve(2 * num_prims - 1);
+
+  recursive_build(prims, 0, num_prims, -1);
+
+  order_.clear();
+  order_.shrink_to_fit();
+}
+
+LightTree::BuildResult LightTree::recursive_build(const vector<LightTreePrimitive> &prims,
+                                                  const int begin,
+                                                  const int end,
+                                                  const int parent_index)
+{
+  const int node_index = nodes_.size();
+  nodes_.emplace_back();
+
+  if (end - begin == 1) {
+    const int prim_index = order_[begin];
+    const LightTreePrimitive &prim = prims[prim_index];
+    const BuildResult result = {prim.bbox, prim.cone, prim.energy};
+    leaves_[prim_index] = node_index;
+    store_node(node_index, result, -1 - prim.distribution_index, parent_index);
+    return result;
+  }
+
+  /* Median split along the largest extent of the centroids, which keeps the tree balanced. */
+  BoundBox centroid_bounds = BoundBox::empty;
+  for (int i = begin; i < end; i++) {
+    centroid_bounds.grow(prims[order_[i]].bbox.center());
+  }
+  const float3 extent = centroid_bounds.size();
+  const int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 :
+                   (extent.y >= extent.z)                         ? 1 :
+                                                                    2;
+
+  const int middle = (begin + end) / 2;
+  std::nth_element(order_.begin() + begin,
+                   order_.begin() + middle,
+                   order_.begin() + end,
+                   [&](const int a, const int b) {
+                     return prims[a].bbox.center()[axis] < prims[b].bbox.center()[axis];
+                   });
+
+  const BuildResult left = recursive_build(prims, begin, middle, node_index);
+  const int right_index = nodes_.size();
+  const BuildResult right = recursive_build(prims, middle, end, node_index);
+
+  BuildResult result;
+  result.bbox = left.bbox;
+  result.bbox.grow(right.bbox);
+  result.cone = LightTreeCone::merge(left.cone, right.cone);
+  result.energy = left.energy + right.energy;
+
+  store_node(node_index, result, right_index, parent_index);
+  return result;
+}
+
+void LightTree::store_node(const int node_index,
+                           const BuildResult &result,
+                           const int child_index,
+                           const int parent_index)
+{
+  KernelLightTreeNode &knode = nodes_[node_index];
+
+  knode.bounding_box_min[0] = result.bbox.min.x;
+  knode.bounding_box_min[1] = result.bbox.min.y;
+  knode.bounding_box_min[2] = result.bbox.min.z;
+  knode.bounding_box_max[0] = result.bbox.max.x;
+  knode.bounding_box_max[1] = result.bbox.max.y;
+  knode.bounding_box_max[2] = result.bbox.max.z;
+  knode.energy = result.energy;
+
+  knode.axis[0] = result.cone.axis.x;
+  knode.axis[1] = result.cone.axis.y;
+  knode.axis[2] = result.cone.axis.z;
+  knode.theta_o = result.cone.theta_o;
+  knode.theta_e = result.cone.theta_e;
+
+  knode.child_index = child_index;
+  knode.parent_index = parent_index;
+  knode.pad1 = 0;
+  knode.pad2 = 0;
+}
+
+CCL_NAMESPACE_END
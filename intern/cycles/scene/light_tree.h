@@ -0,0 +1,90 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIGHT_TREE_H__
+#define __LIGHT_TREE_H__
+
+#include "kernel/types.h"
+
+#include "util/boundbox.h"
+#include "util/types.h"
+#include "util/vector.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Bounds on the orientation of a set of emitters: their normals lie within theta_o of the axis,
+ * and each of them emits within theta_e of its normal. */
+struct LightTreeCone {
+  float3 axis;
+  float theta_o;
+  float theta_e;
+
+  LightTreeCone() = default;
+  LightTreeCone(const float3 &axis, float theta_o, float theta_e)
+      : axis(axis), theta_o(theta_o), theta_e(theta_e)
+  {
+  }
+
+  static LightTreeCone merge(const LightTreeCone &a, const LightTreeCone &b);
+};
+
+/* Emitter of the light distribution that is placed in the tree. */
+struct LightTreePrimitive {
+  BoundBox bbox;
+  LightTreeCone cone;
+  /* Estimated intensity, in the direction of the cone axis. */
+  float energy;
+  int distribution_index;
+};
+
+/* Binary tree with one emitter in each leaf, built by median splits along the largest axis of
+ * the emitter centroids. Nodes are stored depth first, in the layout used by the kernel. */
+class LightTree {
+ public:
+  explicit LightTree(const vector<LightTreePrimitive> &prims);
+
+  const vector<KernelLightTreeNode> &get_nodes() const
+  {
+    return nodes_;
+  }
+
+  /* Node index of the leaf of each primitive, in the order they were passed in. */
+  const vector<int> &get_leaves() const
+  {
+    return leaves_;
+  }
+
+ protected:
+  struct BuildResult {
+    BoundBox bbox;
+    LightTreeCone cone;
+    float energy;
+  };
+
+  BuildResult recursive_build(const vector<LightTreePrimitive> &prims,
+                              int begin,
+                              int end,
+                              int parent_index);
+  void store_node(int node_index, const BuildResult &result, int child_index, int parent_index);
+
+  vector<int> order_;
+  vector<int> leaves_;
+  vector<KernelLightTreeNode> nodes_;
+};
+
+CCL_NAMESPACE_END
+
+#endif /* __LIGHT_TREE_H__ */
@@ -400,10 +400,24 @@ static float object_volume_density(const Transform &tfm, Geometry *geom)
   return 1.0f;
 }
 
+static bool object_has_vertex_motion(Geometry *geom)
+{
+  if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::POINTCLOUD) {
+    /* TODO: why only mesh? */
+    Mesh *mesh = static_cast<Mesh *>(geom);
+    return mesh->attributes.find(ATTR_STD_MOTION_VERTEX_POSITION) != NULL;
+  }
+  return false;
+}
+
 void ObjectManager::device_update_object_transform(UpdateObjectTransformState *state,
                                                    Object *ob,
                                                    bool update_all)
 {
+  /* TODO: instances of the same geometry each get a full KernelObject, including the fields
+   * that only depend on the geometry, and their own top level BVH leaf. A shared prototype with
+   * a packed transform array and optional per-instance attributes needs changes to sync, the
+   * kernel object indexing and the BVH builders. */
   KernelObject &kobject = state->objects[ob->index];
   Transform *object_motion_pass = state->object_motion_pass;
 
@@ -437,17 +451,12 @@ void ObjectManager::device_update_object_transform(UpdateObjectTransformState *s
     state->have_motion = true;
   }
 
-  if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::POINTCLOUD) {
-    /* TODO: why only mesh? */
-    Mesh *mesh = static_cast<Mesh *>(geom);
-    if (mesh->attributes.find(ATTR_STD_MOTION_VERTEX_POSITION)) {
-      flag |= SD_OBJECT_HAS_VERTEX_MOTION;
-    }
+  if (object_has_vertex_motion(geom)) {
+    flag |= SD_OBJECT_HAS_VERTEX_MOTION;
   }
 
-  if (state->need_motion == Scene::MOTION_PASS) {
-    /* Clear motion array if there is no actual motion. */
-    ob->update_motion();
+  if (state->need_motion == Scene::MOTION_PASS && state->motion_offset[ob->index] != 0) {
+    kobject.motion_offset = state->motion_offset[ob->index];
 
     /* Compute motion transforms. */
     Transform tfm_pre, tfm_post;
@@ -468,9 +477,8 @@ void ObjectManager::device_update_object_transform(UpdateObjectTransformState *s
       tfm_post = tfm_post * itfm;
     }
 
-    int motion_pass_offset = ob->index * OBJECT_MOTION_PASS_SIZE;
-    object_motion_pass[motion_pass_offset + 0] = tfm_pre;
-    object_motion_pass[motion_pass_offset + 1] = tfm_post;
+    object_motion_pass[kobject.motion_offset + 0] = tfm_pre;
+    object_motion_pass[kobject.motion_offset + 1] = tfm_post;
   }
   else if (state->need_motion == Scene::MOTION_BLUR) {
     if (ob->use_motion()) {
@@ -579,8 +587,29 @@ void ObjectManager::device_update_transforms(DeviceScene *dscene, Scene *scene,
   state.object_motion_pass = NULL;
 
   if (state.need_motion == Scene::MOTION_PASS) {
-    state.object_motion_pass = dscene->object_motion_pass.alloc(OBJECT_MOTION_PASS_SIZE *
-                                                                scene->objects.size());
+    /* Set object offsets into global object motion pass array. Objects without motion all use
+     * the identity transforms at the start of the array, so static instances take no space. */
+    uint *motion_offsets = state.motion_offset.resize(scene->objects.size());
+    uint motion_offset = OBJECT_MOTION_PASS_SIZE;
+
+    foreach (Object *ob, scene->objects) {
+      /* Clear motion array if there is no actual motion. */
+      ob->update_motion();
+
+      if (ob->use_motion() || object_has_vertex_motion(ob->geometry)) {
+        *motion_offsets = motion_offset;
+        motion_offset += OBJECT_MOTION_PASS_SIZE;
+      }
+      else {
+        *motion_offsets = 0;
+      }
+      motion_offsets++;
+    }
+
+    state.object_motion_pass = dscene->object_motion_pass.alloc(motion_offset);
+    for (int i = 0; i < OBJECT_MOTION_PASS_SIZE; i++) {
+      state.object_motion_pass[i] = transform_identity();
+    }
   }
   else if (state.need_motion == Scene::MOTION_BLUR) {
     /* Set object offsets into global object motion array. */
@@ -715,7 +744,7 @@ void ObjectManager::device_update(Device *device,
 
   /* prepare for static BVH building */
   /* todo: do before to support getting object level coords? */
-  if (scene->params.bvh_type == BVH_TYPE_STATIC) {
+  if (scene->params.bvh_type == BVH_TYPE_STATIC && !scene->params.use_persistent_bvh) {
     scoped_callback_timer timer([scene](double time) {
       if (scene->update_stats) {
         scene->update_stats->object.times.add_entry(
@@ -84,6 +84,11 @@ DeviceScene::DeviceScene(Device *device)
       lights(device, "__lights", MEM_GLOBAL),
       light_background_marginal_cdf(device, "__light_background_marginal_cdf", MEM_GLOBAL),
       light_background_conditional_cdf(device, "__light_background_conditional_cdf", MEM_GLOBAL),
+      light_tree_nodes(device, "__light_tree_nodes", MEM_GLOBAL),
+      light_tree_lamp_leaf(device, "__light_tree_lamp_leaf", MEM_GLOBAL),
+      light_tree_triangle_leaf(device, "__light_tree_triangle_leaf", MEM_GLOBAL),
+      light_tree_object_offset(device, "__light_tree_object_offset", MEM_GLOBAL),
+      light_tree_distant(device, "__light_tree_distant", MEM_GLOBAL),
       particles(device, "__particles", MEM_GLOBAL),
       svm_nodes(device, "__svm_nodes", MEM_GLOBAL),
       shaders(device, "__shaders", MEM_GLOBAL),
@@ -106,6 +111,7 @@ Scene::Scene(const SceneParams &params_, Device *device)
       dscene(device),
       params(params_),
       update_stats(NULL),
+      print_update_stats(false),
       kernels_loaded(false),
       /* TODO(sergey): Check if it's indeed optimal value for the split kernel. */
       max_closure_global(1)
@@ -122,6 +128,9 @@ Scene::Scene(const SceneParams &params_, Device *device)
   geometry_manager = new GeometryManager();
   object_manager = new ObjectManager();
   image_manager = new ImageManager(device->info);
+  if (params.use_texture_cache && device->info.type == DEVICE_CPU && !shader_manager->use_osl()) {
+    image_manager->set_texture_cache(params.texture_cache_size);
+  }
   particle_system_manager = new ParticleSystemManager();
   bake_manager = new BakeManager();
   procedural_manager = new ProceduralManager();
@@ -248,7 +257,7 @@ void Scene::device_update(Device *device_, Progress &progress)
     if (update_stats) {
       update_stats->scene.times.add_entry({"device_update", time});
 
-      if (print_stats) {
+      if (print_stats && print_update_stats) {
         printf("Update statistics:\n%s\n", update_stats->full_report().c_str());
       }
     }
@@ -477,11 +486,12 @@ void Scene::collect_statistics(RenderStats *stats)
   image_manager->collect_statistics(stats);
 }
 
-void Scene::enable_update_stats()
+void Scene::enable_update_stats(bool print_stats)
 {
   if (!update_stats) {
     update_stats = new SceneUpdateStats();
   }
+  print_update_stats = print_stats;
 }
 
 void Scene::update_kernel_features()
@@ -123,6 +123,11 @@ class DeviceScene {
   device_vector<KernelLight> lights;
   device_vector<float2> light_background_marginal_cdf;
   device_vector<float2> light_background_conditional_cdf;
+  device_vector<KernelLightTreeNode> light_tree_nodes;
+  device_vector<int> light_tree_lamp_leaf;
+  device_vector<int> light_tree_triangle_leaf;
+  device_vector<int2> light_tree_object_offset;
+  device_vector<int> light_tree_distant;
 
   /* particles */
   device_vector<KernelParticle> particles;
@@ -159,6 +164,10 @@ class SceneParams {
   BVHLayout bvh_layout;
 
   BVHType bvh_type;
+  /* Keep object transforms out of the geometry even for a static BVH, so that geometry BVHs
+   * persist across frames and are refit when the topology does not change. Only the top-level
+   * BVH is rebuilt then. */
+  bool use_persistent_bvh;
   bool use_bvh_spatial_split;
   bool use_bvh_unaligned_nodes;
   int num_bvh_time_steps;
@@ -166,6 +175,10 @@ class SceneParams {
   CurveShapeType hair_shape;
   int texture_limit;
 
+  /* Sample image files through a texture cache with the given memory limit in MB, CPU only. */
+  bool use_texture_cache;
+  int texture_cache_size;
+
   bool background;
 
   SceneParams()
@@ -173,24 +186,29 @@ class SceneParams {
     shadingsystem = SHADINGSYSTEM_SVM;
     bvh_layout = BVH_LAYOUT_BVH2;
     bvh_type = BVH_TYPE_DYNAMIC;
+    use_persistent_bvh = false;
     use_bvh_spatial_split = false;
     use_bvh_unaligned_nodes = true;
     num_bvh_time_steps = 0;
     hair_subdivisions = 3;
     hair_shape = CURVE_RIBBON;
     texture_limit = 0;
+    use_texture_cache = false;
+    texture_cache_size = 4096;
     background = true;
   }
 
   bool modified(const SceneParams &params) const
   {
     return !(shadingsystem == params.shadingsystem && bvh_layout == params.bvh_layout &&
-             bvh_type == params.bvh_type &&
+             bvh_type == params.bvh_type && use_persistent_bvh == params.use_persistent_bvh &&
              use_bvh_spatial_split == params.use_bvh_spatial_split &&
              use_bvh_unaligned_nodes == params.use_bvh_unaligned_nodes &&
              num_bvh_time_steps == params.num_bvh_time_steps &&
              hair_subdivisions == params.hair_subdivisions && hair_shape == params.hair_shape &&
-             texture_limit == params.texture_limit);
+             texture_limit == params.texture_limit &&
+             use_texture_cache == params.use_texture_cache &&
+             texture_cache_size == params.texture_cache_size);
   }
 
   int curve_subdivisions()
@@ -254,6 +272,8 @@ class Scene : public NodeOwner {
 
   /* scene update statistics */
   SceneUpdateStats *update_stats;
+  /* print update statistics after each device update */
+  bool print_update_stats;
 
   Scene(const SceneParams &params, Device *device);
   ~Scene();
@@ -275,7 +295,7 @@ class Scene : public NodeOwner {
 
   void collect_statistics(RenderStats *stats);
 
-  void enable_update_stats();
+  void enable_update_stats(bool print_stats = true);
 
   bool update(Progress &progress);
 
@@ -396,6 +396,18 @@ void ImageTextureNode::compile(SVMCompiler &compiler)
     }
   }
 
+  /* Mipmap selection for cached images uses the derivatives of the default UV map, which only
+   * match the lookup when the image is mapped with those coordinates unchanged. An unlinked
+   * vector input is connected to the UV output of a texture coordinate node by the graph. */
+  if (projection == NODE_IMAGE_PROJ_FLAT && vector_in->link && tex_mapping.skip()) {
+    ShaderNode *node = vector_in->link->parent;
+    if (node->type == TextureCoordinateNode::get_node_type() &&
+        vector_in->link == node->output("UV") &&
+        !((TextureCoordinateNode *)node)->get_from_dupli()) {
+      flags |= NODE_IMAGE_USE_UV_DIFFERENTIALS;
+    }
+  }
+
   if (projection != NODE_IMAGE_PROJ_BOX) {
     /* If there only is one image (a very common case), we encode it as a negative value. */
     int num_nodes;
@@ -101,6 +101,18 @@ string NamedSizeStats::full_report(int indent_level)
   return result;
 }
 
+string NamedSizeStats::json_report() const
+{
+  string result = string_printf("{\"total\": %zu, \"entries\": [", total_size);
+  for (size_t i = 0; i < entries.size(); i++) {
+    result += string_printf("%s{\"name\": %s, \"size\": %zu}",
+                            (i == 0) ? "" : ", ",
+                            string_json_quote(entries[i].name).c_str(),
+                            entries[i].size);
+  }
+  return result + "]}";
+}
+
 string NamedTimeStats::full_report(int indent_level)
 {
   const string indent(indent_level * kIndentNumSpaces, ' ');
@@ -115,6 +127,18 @@ string NamedTimeStats::full_report(int indent_level)
   return result;
 }
 
+string NamedTimeStats::json_report() const
+{
+  string result = string_printf("{\"total\": %f, \"entries\": [", total_time);
+  for (size_t i = 0; i < entries.size(); i++) {
+    result += string_printf("%s{\"name\": %s, \"time\": %f}",
+                            (i == 0) ? "" : ", ",
+                            string_json_quote(entries[i].name).c_str(),
+                            entries[i].time);
+  }
+  return result + "]}";
+}
+
 /* Named time sample statistics. */
 
 NamedNestedSampleStats::NamedNestedSampleStats() : name(""), self_samples(0), sum_samples(0)
@@ -326,6 +350,12 @@ string RenderStats::full_report()
   return result;
 }
 
+string RenderStats::json_report() const
+{
+  return "{\"mesh\": " + mesh.geometry.json_report() +
+         ", \"image\": " + image.textures.json_report() + "}";
+}
+
 NamedTimeStats::NamedTimeStats() : total_time(0.0)
 {
 }
@@ -360,6 +390,27 @@ string SceneUpdateStats::full_report()
   return result;
 }
 
+string SceneUpdateStats::json_report() const
+{
+  string result = "{";
+  result += "\"scene\": " + scene.times.json_report();
+  result += ", \"geometry\": " + geometry.times.json_report();
+  result += ", \"light\": " + light.times.json_report();
+  result += ", \"object\": " + object.times.json_report();
+  result += ", \"image\": " + image.times.json_report();
+  result += ", \"background\": " + background.times.json_report();
+  result += ", \"bake\": " + bake.times.json_report();
+  result += ", \"camera\": " + camera.times.json_report();
+  result += ", \"film\": " + film.times.json_report();
+  result += ", \"integrator\": " + integrator.times.json_report();
+  result += ", \"osl\": " + osl.times.json_report();
+  result += ", \"particles\": " + particles.times.json_report();
+  result += ", \"svm\": " + svm.times.json_report();
+  result += ", \"tables\": " + tables.times.json_report();
+  result += ", \"procedurals\": " + procedurals.times.json_report();
+  return result + "}";
+}
+
 void SceneUpdateStats::clear()
 {
   geometry.times.clear();
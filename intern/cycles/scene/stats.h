@@ -64,6 +64,9 @@ class NamedSizeStats {
   /* Generate full human-readable report. */
   string full_report(int indent_level = 0);
 
+  /* Generate report as a JSON object, with sizes in bytes. */
+  string json_report() const;
+
   /* Total size of all entries. */
   size_t total_size;
 
@@ -87,6 +90,9 @@ class NamedTimeStats {
   /* Generate full human-readable report. */
   string full_report(int indent_level = 0);
 
+  /* Generate report as a JSON object, with times in seconds. */
+  string json_report() const;
+
   /* Total time of all entries. */
   double total_time;
 
@@ -181,6 +187,9 @@ class RenderStats {
   /* Return full report as string. */
   string full_report();
 
+  /* Return memory usage of meshes and images as a JSON object. */
+  string json_report() const;
+
   /* Collect kernel sampling information from Stats. */
   void collect_profiling(Scene *scene, Profiler &prof);
 
@@ -222,6 +231,7 @@ class SceneUpdateStats {
   UpdateTimeStats procedurals;
 
   string full_report();
+  string json_report() const;
 
   void clear();
 };
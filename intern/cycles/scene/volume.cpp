@@ -16,6 +16,7 @@
 
 #include "scene/volume.h"
 #include "scene/attribute.h"
+#include "scene/image.h"
 #include "scene/image_vdb.h"
 #include "scene/scene.h"
 
@@ -23,6 +24,7 @@
 #  include <openvdb/tools/Dense.h>
 #  include <openvdb/tools/GridTransformer.h>
 #  include <openvdb/tools/Morphology.h>
+#  include <openvdb/tools/Prune.h>
 #endif
 
 #include "util/foreach.h"
@@ -41,6 +43,7 @@ NODE_DEFINE(Volume)
   SOCKET_FLOAT(clipping, "Clipping", 0.001f);
   SOCKET_FLOAT(step_size, "Step Size", 0.0f);
   SOCKET_BOOLEAN(object_space, "Object Space", false);
+  SOCKET_BOOLEAN(skip_empty_space, "Skip Empty Space", false);
 
   return type;
 }
@@ -50,6 +53,7 @@ Volume::Volume() : Mesh(get_node_type(), Geometry::VOLUME)
   clipping = 0.001f;
   step_size = 0.0f;
   object_space = false;
+  skip_empty_space = false;
 }
 
 void Volume::clear(bool preserve_shaders)
@@ -144,10 +148,14 @@ static void create_quad(int3 corners[8],
  * The way the algorithm works is as follows:
  *
  * - The topologies of input OpenVDB grids are merged into a temporary grid.
+ * - Leaf nodes without active voxels, for example where all values are below the clipping
+ * threshold, are pruned so that empty space inside the volume bounds is skipped when rendering.
  * - Voxels of the temporary grid are dilated to account for the padding necessary for volume
  * sampling.
  * - Quads are created on the boundary between active and inactive leaf nodes of the temporary
  * grid.
+ * - When the volume skips empty space, the active voxels of the temporary grid are stored as
+ * occupancy grid, which the kernel uses to skip empty space inside the leaf nodes.
  */
 class VolumeMeshBuilder {
  public:
@@ -184,6 +192,8 @@ class VolumeMeshBuilder {
   bool empty_grid() const;
 
 #ifdef WITH_OPENVDB
+  openvdb::GridBase::ConstPtr create_occupancy_grid() const;
+
   template<typename GridType>
   void merge_grid(openvdb::GridBase::ConstPtr grid, bool do_clipping, float volume_clipping)
   {
@@ -265,6 +275,10 @@ void VolumeMeshBuilder::add_grid(openvdb::GridBase::ConstPtr grid,
   else if (grid->isType<openvdb::MaskGrid>()) {
     topology_grid->topologyUnion(*openvdb::gridConstPtrCast<openvdb::MaskGrid>(grid));
   }
+
+  /* The union keeps the leaf nodes of the input grid even if none of their voxels are active,
+   * remove them so no quads are created around them. */
+  openvdb::tools::pruneInactive(topology_grid->tree());
 }
 #endif
 
@@ -433,6 +447,35 @@ bool VolumeMeshBuilder::empty_grid() const
 #endif
 }
 
+#ifdef WITH_OPENVDB
+openvdb::GridBase::ConstPtr VolumeMeshBuilder::create_occupancy_grid() const
+{
+  /* The occupancy is looked up with closest interpolation, while the voxel grids may be looked up
+   * with linear or cubic interpolation half a voxel off. Dilate by one more voxel so that voxels
+   * whose values contribute to the interpolated result are always occupied. */
+  openvdb::MaskGrid::Ptr mask_grid = topology_grid->deepCopy();
+  openvdb::tools::dilateVoxels(mask_grid->tree(), 1);
+
+  openvdb::FloatTree::Ptr tree(
+      new openvdb::FloatTree(mask_grid->tree(), 0.0f, 1.0f, openvdb::TopologyCopy()));
+  openvdb::FloatGrid::Ptr occupancy_grid = openvdb::FloatGrid::create(tree);
+  occupancy_grid->setTransform(topology_grid->transform().copy());
+
+  return occupancy_grid;
+}
+
+/* Image loader for the occupancy grid of a volume, which is not backed by any file or grid
+ * from the host application. */
+class VolumeOccupancyLoader : public VDBImageLoader {
+ public:
+  VolumeOccupancyLoader(openvdb::GridBase::ConstPtr occupancy_grid, const string &volume_name)
+      : VDBImageLoader(volume_name + " occupancy")
+  {
+    grid = occupancy_grid;
+  }
+};
+#endif
+
 #ifdef WITH_OPENVDB
 template<typename GridType>
 static openvdb::GridBase::ConstPtr openvdb_grid_from_device_texture(device_texture *image_memory,
@@ -499,7 +542,7 @@ static openvdb::GridBase::ConstPtr openvdb_grid_from_device_texture(device_textu
 
 /* ************************************************************************** */
 
-void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
+void GeometryManager::create_volume_mesh(const Scene *scene, Volume *volume, Progress &progress)
 {
   string msg = string_printf("Computing Volume Mesh %s", volume->name.c_str());
   progress.set_status("Updating Mesh", msg);
@@ -532,6 +575,7 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
    * Also keep the shaders to avoid infinite loops when synchronizing, as this will tag the shaders
    * as having changed. */
   volume->clear(true);
+  volume->attributes.remove(ATTR_STD_VOLUME_OCCUPANCY);
   volume->need_update_rebuild = true;
 
   if (!volume_shader) {
@@ -543,7 +587,7 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
 
 #ifdef WITH_OPENVDB
   foreach (Attribute &attr, volume->attributes.attributes) {
-    if (attr.element != ATTR_ELEMENT_VOXEL) {
+    if (attr.element != ATTR_ELEMENT_VOXEL || attr.std == ATTR_STD_VOLUME_OCCUPANCY) {
       continue;
     }
 
@@ -624,6 +668,25 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
     fN[i] = face_normals[i];
   }
 
+#ifdef WITH_NANOVDB
+  /* Occupancy of the voxels inside the volume mesh, used by the kernel to skip evaluating the
+   * volume shader in empty space. Only done when the volume opts in, since the shader may give
+   * density or emission that does not come from the voxel grids. Without NanoVDB the grid would
+   * become a dense texture as large as the volume bounds, costing more than it saves. */
+  if (volume->get_skip_empty_space() && scene->image_manager->device_has_nanovdb()) {
+    ImageParams params;
+    params.interpolation = INTERPOLATION_CLOSEST;
+
+    Attribute *attr_occupancy = volume->attributes.add(ATTR_STD_VOLUME_OCCUPANCY);
+    attr_occupancy->data_voxel() = scene->image_manager->add_image(
+        new VolumeOccupancyLoader(builder.create_occupancy_grid(), volume->name.string()),
+        params,
+        false);
+  }
+#else
+  (void)scene;
+#endif
+
   /* Print stats. */
   VLOG(1) << "Memory usage volume mesh: "
           << ((vertices.size() + face_normals.size()) * sizeof(float3) +
@@ -31,6 +31,7 @@ class Volume : public Mesh {
   NODE_SOCKET_API(float, clipping)
   NODE_SOCKET_API(float, step_size)
   NODE_SOCKET_API(bool, object_space)
+  NODE_SOCKET_API(bool, skip_empty_space)
 
   virtual void clear(bool preserve_shaders = false) override;
 };
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2011-2022 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "testing/testing.h"
+
+#include "kernel/device/cpu/compat.h"
+#include "kernel/device/cpu/globals.h"
+
+#include "kernel/light/tree.h"
+
+#include "scene/light_tree.h"
+
+#include "util/hash.h"
+#include "util/vector.h"
+
+CCL_NAMESPACE_BEGIN
+
+namespace {
+
+/* Tree over a few emitters in random positions, with kernel globals for evaluating it. */
+class LightTreeTest : public ::testing::Test {
+ protected:
+  void build(const int num_prims, const bool oriented)
+  {
+    prims.clear();
+    for (int i = 0; i < num_prims; i++) {
+      const float3 center = make_float3(hash_uint2_to_float(i, 0) * 10.0f,
+                                        hash_uint2_to_float(i, 1) * 10.0f,
+                                        hash_uint2_to_float(i, 2) * 10.0f);
+      const float size = 0.1f + hash_uint2_to_float(i, 3);
+
+      LightTreePrimitive prim;
+      prim.bbox = BoundBox(center - make_float3(size), center + make_float3(size));
+      prim.cone = (oriented) ? LightTreeCone(make_float3(0.0f, 0.0f, (i % 2) ? 1.0f : -1.0f),
+                                             0.0f,
+                                             M_PI_2_F) :
+                               LightTreeCone(make_float3(0.0f, 0.0f, 1.0f), M_PI_F, M_PI_2_F);
+      prim.energy = 0.5f + hash_uint2_to_float(i, 4) * 10.0f;
+      prim.distribution_index = i;
+      prims.push_back(prim);
+    }
+
+    LightTree tree(prims);
+    nodes = tree.get_nodes();
+    leaves = tree.get_leaves();
+
+    kg_data.__light_tree_nodes.data = nodes.data();
+    kg_data.__light_tree_nodes.width = nodes.size();
+  }
+
+  /* Sum of the probabilities of selecting each emitter from P. */
+  float pdf_sum(const float3 P) const
+  {
+    float sum = 0.0f;
+    for (const int leaf : leaves) {
+      sum += light_tree_pdf(&kg_data, P, leaf);
+    }
+    return sum;
+  }
+
+  /* Check that the pdf returned when sampling, the pdf evaluated for the selected leaf and the
+   * frequency at which each emitter is selected all agree. */
+  void check_sampling(const float3 P) const
+  {
+    const int num_samples = 100000;
+    vector<int> counts(prims.size(), 0);
+
+    for (int i = 0; i < num_samples; i++) {
+      float randu = (i + 0.5f) / num_samples;
+      float pdf;
+      const int index = light_tree_sample(&kg_data, P, &randu, &pdf);
+      ASSERT_GE(index, 0);
+      ASSERT_LT(index, int(prims.size()));
+      EXPECT_NEAR(pdf, light_tree_pdf(&kg_data, P, leaves[index]), 1e-5f);
+      EXPECT_GE(randu, 0.0f);
+      EXPECT_LE(randu, 1.0f);
+      counts[index]++;
+    }
+
+    for (size_t i = 0; i < prims.size(); i++) {
+      EXPECT_NEAR(float(counts[i]) / num_samples, light_tree_pdf(&kg_data, P, leaves[i]), 1e-3f);
+    }
+  }
+
+  vector<LightTreePrimitive> prims;
+  vector<KernelLightTreeNode> nodes;
+  vector<int> leaves;
+  KernelGlobalsCPU kg_data;
+};
+
+}  // namespace
+
+TEST_F(LightTreeTest, single_emitter)
+{
+  build(1, false);
+
+  EXPECT_EQ(nodes.size(), size_t(1));
+  EXPECT_FLOAT_EQ(pdf_sum(make_float3(20.0f, 0.0f, 0.0f)), 1.0f);
+  check_sampling(make_float3(20.0f, 0.0f, 0.0f));
+}
+
+TEST_F(LightTreeTest, pdf_sums_to_one)
+{
+  for (const int num_prims : {2, 3, 7, 16, 33}) {
+    build(num_prims, false);
+
+    EXPECT_EQ(nodes.size(), size_t(2 * num_prims - 1));
+    for (int i = 0; i < 8; i++) {
+      const float3 P = make_float3(hash_uint2_to_float(i, 10) * 20.0f - 5.0f,
+                                   hash_uint2_to_float(i, 11) * 20.0f - 5.0f,
+                                   hash_uint2_to_float(i, 12) * 20.0f - 5.0f);
+      EXPECT_NEAR(pdf_sum(P), 1.0f, 1e-4f);
+    }
+  }
+}
+
+TEST_F(LightTreeTest, pdf_matches_sampling)
+{
+  build(7, false);
+  check_sampling(make_float3(-3.0f, 2.0f, 12.0f));
+  check_sampling(make_float3(5.0f, 5.0f, 5.0f));
+
+  build(12, true);
+  check_sampling(make_float3(5.0f, 5.0f, 30.0f));
+  check_sampling(make_float3(5.0f, 5.0f, -30.0f));
+}
+
+TEST_F(LightTreeTest, oriented_emitters)
+{
+  /* Above all emitters only the ones facing up contribute. */
+  build(6, true);
+
+  const float3 P = make_float3(5.0f, 5.0f, 100.0f);
+  EXPECT_NEAR(pdf_sum(P), 1.0f, 1e-4f);
+  for (size_t i = 0; i < prims.size(); i++) {
+    if (prims[i].cone.axis.z < 0.0f) {
+      EXPECT_EQ(light_tree_pdf(&kg_data, P, leaves[i]), 0.0f);
+    }
+    else {
+      EXPECT_GT(light_tree_pdf(&kg_data, P, leaves[i]), 0.0f);
+    }
+  }
+}
+
+CCL_NAMESPACE_END
@@ -184,6 +184,24 @@ string string_to_lower(const string &s)
   return r;
 }
 
+string string_json_quote(const string &s)
+{
+  string result = "\"";
+  for (const char c : s) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    }
+    else if ((unsigned char)c < 0x20) {
+      result += string_printf("\\u%04x", (int)c);
+    }
+    else {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
 /* Wide char strings helpers for Windows. */
 
 #ifdef _WIN32
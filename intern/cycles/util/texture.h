@@ -91,9 +91,23 @@ typedef struct TextureInfo {
   uint width, height, depth;
   /* Transform for 3D textures. */
   uint use_transform_3d;
+  /* Image sampled through the texture cache, CPU device only. */
+  uint64_t cache_image;
   Transform transform_3d;
 } TextureInfo;
 
+#ifndef __KERNEL_GPU__
+/* Image that is not stored in device memory, but sampled from a texture cache on the host that
+ * loads tiles of the image on demand. Derivatives of the texture coordinates are used to select
+ * the mipmap level. Returned values follow the same conventions as pixels in device memory. */
+class TextureCacheImage {
+ public:
+  virtual ~TextureCacheImage() = default;
+
+  virtual float4 lookup(float x, float y, float dsdx, float dtdx, float dsdy, float dtdy) const = 0;
+};
+#endif
+
 CCL_NAMESPACE_END
 
 #endif /* __UTIL_TEXTURE_H__ */
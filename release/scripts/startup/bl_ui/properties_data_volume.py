@@ -130,6 +130,7 @@ class DATA_PT_volume_render(DataButtonsPanel, Panel):
 
             col = layout.column(align=True)
             col.prop(render, "clipping")
+            col.prop(render, "use_skip_empty_space")
 
 
 class DATA_PT_volume_viewport_display(DataButtonsPanel, Panel):
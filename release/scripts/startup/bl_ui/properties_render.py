@@ -538,6 +538,7 @@ class RENDER_PT_eevee_performance(RenderButtonsPanel, Panel):
         layout.use_property_split = True
 
         layout.prop(rd, "use_high_quality_normals")
+        layout.prop(rd, "use_compressed_uvs")
 
 
 class RENDER_PT_gpencil(RenderButtonsPanel, Panel):
@@ -75,6 +75,13 @@ typedef enum eCDAllocType {
   CD_REFERENCE = 3,
   /** Do a full copy of all layers, only allowed if source has same number of elements. */
   CD_DUPLICATE = 4,
+  /**
+   * Share the data of the source layers with reference counting, so that it stays valid when the
+   * source is freed. The layers are handled like referenced layers otherwise. Layers which don't
+   * own their data are duplicated instead. Only supported by #CustomData_copy and
+   * #CustomData_merge.
+   */
+  CD_SHARE = 5,
 } eCDAllocType;
 
 #define CD_TYPE_AS_MASK(_type) (CustomDataMask)((CustomDataMask)1 << (CustomDataMask)(_type))
@@ -89,6 +89,13 @@ typedef struct BMEditMesh {
    */
   char needs_flush_to_id;
 
+  /**
+   * Set while updates of the edit-mesh only move vertices (transform for example),
+   * topology, selection and custom-data of `bm` are left unchanged.
+   * Allows the draw cache to update positions & normals of the moved vertices only.
+   */
+  char is_deform_update;
+
 } BMEditMesh;
 
 /* editmesh.c */
@@ -170,6 +170,8 @@ enum {
   /** When copying local sub-data (like constraints or modifiers), do not set their "library
    * override local data" flag. */
   LIB_ID_COPY_NO_LIB_OVERRIDE_LOCAL_DATA_FLAG = 1 << 22,
+  /** Mesh: Share CD data layers of evaluated meshes with reference counting, see #CD_SHARE. */
+  LIB_ID_COPY_CD_SHARE = 1 << 23,
 
   /* *** XXX Hackish/not-so-nice specific behaviors needed for some corner cases. *** */
   /* *** Ideally we should not have those, but we need them for now... *** */
@@ -157,6 +157,12 @@ void BKE_mesh_eval_delete(struct Mesh *mesh_eval);
  * optional referencing original arrays to reduce memory.
  */
 struct Mesh *BKE_mesh_copy_for_eval(const struct Mesh *source, bool reference);
+/**
+ * Performs copy for use during evaluation, sharing the data arrays of evaluated meshes with
+ * reference counting instead of duplicating them. The arrays are copied when they are modified,
+ * through #CustomData_duplicate_referenced_layer and similar functions.
+ */
+struct Mesh *BKE_mesh_copy_for_eval_shared(const struct Mesh *source);
 
 /**
  * These functions construct a new Mesh,
@@ -371,6 +377,17 @@ void BKE_mesh_recalc_looptri_with_normals(const struct MLoop *mloop,
                                           int totpoly,
                                           struct MLoopTri *mlooptri,
                                           const float (*poly_normals)[3]);
+/**
+ * Update a #MLoopTri array calculated by #BKE_mesh_recalc_looptri after vertex positions
+ * changed but the topology did not. Triangles are left as they are, since their tessellation
+ * doesn't depend on positions, only quads and n-gons are tessellated again.
+ */
+void BKE_mesh_recalc_looptri_for_positions(const struct MLoop *mloop,
+                                           const struct MPoly *mpoly,
+                                           const struct MVert *mvert,
+                                           int totloop,
+                                           int totpoly,
+                                           struct MLoopTri *mlooptri);
 
 /* *** mesh_normals.cc *** */
 
@@ -389,13 +406,19 @@ const float (*BKE_mesh_vertex_normals_ensure(const struct Mesh *mesh))[3];
 const float (*BKE_mesh_poly_normals_ensure(const struct Mesh *mesh))[3];
 
 /**
- * Tag mesh vertex and face normals to be recalculated when/if they are needed later.
+ * Tag mesh vertex, face and split normals to be recalculated when/if they are needed later.
  *
  * \note Dirty tagged normals are the default state of a new mesh, so tagging them
  * dirty explicitly is not always necessary if the mesh is created locally.
  */
 void BKE_mesh_normals_tag_dirty(struct Mesh *mesh);
 
+/**
+ * Tag only the split normals to be recalculated, for changes that don't affect vertex and face
+ * normals, like sharp edges, smooth faces, auto smooth settings and custom normals.
+ */
+void BKE_mesh_loop_normals_tag_dirty(struct Mesh *mesh);
+
 /**
  * Check that a mesh with non-dirty normals has vertex and face custom data layers.
  * If these asserts fail, it means some area cleared the dirty flag but didn't copy or add the
@@ -445,6 +468,13 @@ bool BKE_mesh_vertex_normals_are_dirty(const struct Mesh *mesh);
  */
 bool BKE_mesh_poly_normals_are_dirty(const struct Mesh *mesh);
 
+/**
+ * Return true if the split normals in the #CD_NORMAL loop layer either are not stored or are
+ * dirty. When false they can be used instead of calling #BKE_mesh_normals_loop_split with the
+ * mesh's auto smooth settings and custom normals.
+ */
+bool BKE_mesh_loop_normals_are_dirty(const struct Mesh *mesh);
+
 /**
  * Calculate face normals directly into a result array.
  *
@@ -674,6 +704,10 @@ void BKE_mesh_normals_loop_to_vertex(int numVerts,
  */
 bool BKE_mesh_has_custom_loop_normals(struct Mesh *me);
 
+/**
+ * Compute 'split' (aka loop, or per face corner's) normals into the #CD_NORMAL loop layer.
+ * Nothing is done when the layer exists and isn't tagged dirty.
+ */
 void BKE_mesh_calc_normals_split(struct Mesh *mesh);
 /**
  * Compute 'split' (aka loop, or per face corner's) normals.
@@ -38,6 +38,7 @@ struct MLoop;
 struct MLoopTri;
 struct MVertTri;
 struct Mesh;
+struct MeshTopologyCache;
 struct Object;
 struct Scene;
 
@@ -59,6 +60,18 @@ void BKE_mesh_runtime_free_data(struct Mesh *mesh);
 void BKE_mesh_runtime_reset_on_copy(struct Mesh *mesh, int flag);
 int BKE_mesh_runtime_looptri_len(const struct Mesh *mesh);
 void BKE_mesh_runtime_looptri_recalc(struct Mesh *mesh);
+/**
+ * Tag the cached #MLoopTri array as out of date after vertex positions changed but the topology
+ * did not, so the next #BKE_mesh_runtime_looptri_ensure updates it in place instead of
+ * rebuilding it. Called by #BKE_mesh_normals_tag_dirty.
+ */
+void BKE_mesh_runtime_looptri_tag_positions_dirty(struct Mesh *mesh);
+/**
+ * Use the cached #MLoopTri array of \a mesh_src for its copy \a mesh_dst, when both meshes
+ * still reference the same topology arrays. The array is only copied when one of the meshes has
+ * to update it.
+ */
+void BKE_mesh_runtime_looptri_share(struct Mesh *mesh_dst, const struct Mesh *mesh_src);
 /**
  * \note This function only fills a cache, and therefore the mesh argument can
  * be considered logically const. Concurrent access is protected by a mutex.
@@ -76,6 +89,14 @@ void BKE_mesh_runtime_clear_geometry(struct Mesh *mesh);
  */
 void BKE_mesh_runtime_clear_cache(struct Mesh *mesh);
 
+/**
+ * Lazily computed topology maps stored in the mesh runtime data, see `BKE_mesh_topology.hh`.
+ * Defined in `mesh_topology.cc`.
+ */
+struct MeshTopologyCache *BKE_mesh_topology_cache_create(void);
+void BKE_mesh_topology_cache_free(struct MeshTopologyCache *cache);
+void BKE_mesh_topology_cache_clear(struct MeshTopologyCache *cache);
+
 /* This is a copy of DM_verttri_from_looptri(). */
 void BKE_mesh_runtime_verttri_from_looptri(struct MVertTri *r_verttri,
                                            const struct MLoop *mloop,
@@ -0,0 +1,81 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup bke
+ *
+ * Topology maps that are computed lazily and cached on the mesh runtime data, so that they can be
+ * shared between all users of the same mesh. The cache is freed together with the other derived
+ * geometry data in #BKE_mesh_runtime_clear_geometry, so it has to be called when the topology of
+ * the mesh changes.
+ *
+ * All functions are thread-safe, the mesh can be considered logically const.
+ */
+
+#include "BLI_array.hh"
+#include "BLI_index_range.hh"
+#include "BLI_span.hh"
+
+struct Mesh;
+
+namespace blender::bke::mesh_topology {
+
+/**
+ * Maps every element of one domain to a group of elements of another domain, stored in
+ * compressed sparse row form. The indices of the group of element `i` are stored in
+ * `indices[offsets[i]]` to `indices[offsets[i + 1] - 1]`.
+ */
+struct ElementMap {
+  /** One more than the number of elements in the source domain. */
+  Array<int> offsets;
+  Array<int> indices;
+
+  int size() const
+  {
+    return offsets.size() - 1;
+  }
+
+  IndexRange group_range(const int64_t index) const
+  {
+    return IndexRange(offsets[index], offsets[index + 1] - offsets[index]);
+  }
+
+  Span<int> operator[](const int64_t index) const
+  {
+    return indices.as_span().slice(this->group_range(index));
+  }
+};
+
+/** Edges that use each vertex. */
+const ElementMap &vert_to_edge_map(const Mesh &mesh);
+/**
+ * Faces that use each vertex. A face is contained once for every corner that uses the vertex,
+ * which only makes a difference for degenerate faces.
+ */
+const ElementMap &vert_to_poly_map(const Mesh &mesh);
+/** Faces that use each edge. */
+const ElementMap &edge_to_poly_map(const Mesh &mesh);
+
+/**
+ * Island index of every vertex, where vertices are in the same island when they are connected by
+ * edges. Island indices are based on the order of the lowest-numbered vertex in each island.
+ */
+Span<int> vert_islands(const Mesh &mesh);
+int islands_num(const Mesh &mesh);
+
+}  // namespace blender::bke::mesh_topology
@@ -722,3 +722,70 @@ struct CurveEval {
 std::unique_ptr<CurveEval> curve_eval_from_dna_curve(const Curve &curve,
                                                      const ListBase &nurbs_list);
 std::unique_ptr<CurveEval> curve_eval_from_dna_curve(const Curve &dna_curve);
+
+namespace blender::bke::curves::bezier {
+
+/**
+ * Evaluate a cubic Bézier segment with forward differencing. The start point is included in the
+ * result, the end point is not, since it is the first point of the next segment.
+ */
+void evaluate_segment(const float3 &point_0,
+                      const float3 &point_1,
+                      const float3 &point_2,
+                      const float3 &point_3,
+                      MutableSpan<float3> result);
+
+/**
+ * Evaluate the positions of a whole Bézier curve stored in flat arrays, without accessing any
+ * spline data. `evaluated_offsets` contains the index of the first evaluated point of each
+ * control point's segment, and the total number of evaluated points at the end. Segments with a
+ * single evaluated point (vector segments) only copy their control point.
+ *
+ * Small curves are evaluated on the calling thread, since the overhead of scheduling tasks is
+ * larger than the work itself, which matters when evaluating many short curves like hair.
+ */
+void calculate_evaluated_positions(Span<float3> positions,
+                                   Span<float3> handles_left,
+                                   Span<float3> handles_right,
+                                   Span<int> evaluated_offsets,
+                                   bool cyclic,
+                                   MutableSpan<float3> evaluated_positions);
+
+/**
+ * Evaluate the positions of many Bézier curves stored in flat arrays. The control points of
+ * curve `i` are `curve_offsets[i]` to `curve_offsets[i + 1]`. `evaluated_offsets` has an entry
+ * for every control point of all curves, with the index of its first evaluated point in
+ * `evaluated_positions`, and the total number of evaluated points at the end. For a non-cyclic
+ * curve, the last control point has a single evaluated point.
+ *
+ * Every curve is evaluated on a single thread, and many curves are evaluated in parallel. This
+ * avoids the overhead of evaluating curves one by one, which dominates for many short curves.
+ */
+void calculate_evaluated_positions(Span<int> curve_offsets,
+                                   Span<bool> cyclic,
+                                   Span<float3> positions,
+                                   Span<float3> handles_left,
+                                   Span<float3> handles_right,
+                                   Span<int> evaluated_offsets,
+                                   MutableSpan<float3> evaluated_positions);
+
+}  // namespace blender::bke::curves::bezier
+
+namespace blender::bke::curves::poly {
+
+/**
+ * Calculate the tangent of every point of a poly curve. For other curve types, the tangents of
+ * the evaluated points are calculated the same way, but the end tangents may need a correction.
+ */
+void calculate_tangents(Span<float3> positions, bool cyclic, MutableSpan<float3> tangents);
+
+/**
+ * Calculate the tangents of many poly curves stored in flat arrays, in parallel. The points of
+ * curve `i` are `curve_offsets[i]` to `curve_offsets[i + 1]`.
+ */
+void calculate_tangents(Span<int> curve_offsets,
+                        Span<bool> cyclic,
+                        Span<float3> positions,
+                        MutableSpan<float3> tangents);
+
+}  // namespace blender::bke::curves::poly
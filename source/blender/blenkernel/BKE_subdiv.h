@@ -199,6 +199,11 @@ typedef struct Subdiv {
      * In total this array has a size of `num base faces + 1`.
      */
     int *face_ptex_offset;
+    /* Hash of the topology and settings this descriptor has been created for. Only used by the
+     * shared descriptor cache, see #BKE_subdiv_cache_acquire. */
+    uint32_t topology_hash;
+    /* Estimated size of this descriptor, limiting the total size of the shared cache. */
+    uint64_t refined_faces_num;
   } cache_;
 } Subdiv;
 
@@ -256,6 +261,21 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
 
 void BKE_subdiv_free(Subdiv *subdiv);
 
+/* ============================== SHARED CACHE ============================== */
+
+/* Get a descriptor for the given settings and mesh from a global cache of recently used
+ * descriptors. When a descriptor with the same settings and topology has been released before,
+ * its topology refiner and evaluator are re-used, so that only the coarse positions have to be
+ * updated when evaluating a deforming mesh. This is meant for users which do not have a place to
+ * store the descriptor between evaluations, like geometry nodes.
+ *
+ * The descriptor is owned by the caller until it is given back with #BKE_subdiv_cache_release.
+ * Returns NULL if the descriptor could not be created. */
+Subdiv *BKE_subdiv_cache_acquire(const SubdivSettings *settings, const struct Mesh *mesh);
+void BKE_subdiv_cache_release(Subdiv *subdiv);
+/* Free all descriptors stored in the cache. */
+void BKE_subdiv_cache_clear(void);
+
 /* ============================ DISPLACEMENT API ============================ */
 
 void BKE_subdiv_displacement_attach_from_multires(Subdiv *subdiv,
@@ -60,6 +60,7 @@
 #include "BKE_scene.h"
 #include "BKE_screen.h"
 #include "BKE_studiolight.h"
+#include "BKE_subdiv.h"
 #include "BKE_undo_system.h"
 #include "BKE_workspace.h"
 
@@ -177,6 +178,9 @@ static void setup_app_data(bContext *C,
     RE_FreeAllRenderResults();
   }
 
+  /* Cached subdivision descriptors were created for the meshes being replaced. */
+  BKE_subdiv_cache_clear();
+
   /* Only make filepaths compatible when loading for real (not undo) */
   if (mode != LOAD_UNDO) {
     clean_paths(bfd->main);
@@ -24,6 +24,8 @@
  * \ingroup bke
  */
 
+#include <atomic>
+
 #include "MEM_guardedalloc.h"
 
 /* Since we have versioning code here (CustomData_verify_versions()). */
@@ -62,6 +64,8 @@
 
 #include "BLO_read_write.h"
 
+#include "atomic_ops.h"
+
 #include "bmesh.h"
 
 #include "CLG_log.h"
@@ -2112,6 +2116,129 @@ static bool customdata_typemap_is_valid(const CustomData *data)
 }
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Layer Sharing
+ * \{ */
+
+/**
+ * Owns a layer data array that is used by multiple layers. The data is freed together with the
+ * last user.
+ */
+struct CustomDataLayerSharing {
+  std::atomic<int> users;
+  int type;
+  int totelem;
+  void *data;
+};
+
+static void customdata_sharing_remove_user(CustomDataLayerSharing *sharing)
+{
+  if (sharing->users.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  const LayerTypeInfo *typeInfo = layerType_getInfo(sharing->type);
+  if (typeInfo->free) {
+    typeInfo->free(sharing->data, sharing->totelem, typeInfo->size);
+  }
+  MEM_SAFE_FREE(sharing->data);
+  MEM_delete(sharing);
+}
+
+/**
+ * A const source layer can be copied from multiple threads at the same time, and sharing it sets
+ * its sharing data and #CD_FLAG_NOFREE. Both are only written with atomic operations there, so
+ * every access that can happen at the same time as a copy has to read them atomically as well.
+ * The sharing data is published before the flag, so a layer that is seen with #CD_FLAG_NOFREE
+ * also has its sharing data visible when it is shared.
+ *
+ * Code that frees or writes to the layer needs exclusive access to it anyway.
+ */
+static int customdata_layer_flag_load(const CustomDataLayer *layer)
+{
+  return atomic_fetch_and_or_int32(const_cast<int32_t *>(&layer->flag), 0);
+}
+
+static CustomDataLayerSharing *customdata_layer_sharing_load(const CustomDataLayer *layer)
+{
+  return static_cast<CustomDataLayerSharing *>(atomic_cas_ptr(
+      reinterpret_cast<void **>(const_cast<CustomDataLayerSharing **>(&layer->sharing)),
+      nullptr,
+      nullptr));
+}
+
+/**
+ * Add a user to the shared data of the given layer. When it isn't shared yet, it is made shared
+ * first if \a make_shared is true.
+ *
+ * The source layer is logically const, but sharing it sets its sharing data and
+ * #CD_FLAG_NOFREE, see #customdata_layer_flag_load. When multiple threads share the same layer,
+ * only the first one publishes its sharing data and the others add a user to it.
+ *
+ * \return Null when the layer is not shared and can't or shouldn't be made shared.
+ */
+static CustomDataLayerSharing *customdata_sharing_add_user(const CustomDataLayer *layer_src,
+                                                           const int totelem,
+                                                           const bool make_shared)
+{
+  CustomDataLayer *layer = const_cast<CustomDataLayer *>(layer_src);
+  CustomDataLayerSharing *sharing = customdata_layer_sharing_load(layer);
+  if (sharing == nullptr) {
+    if (!make_shared || layer->data == nullptr) {
+      return nullptr;
+    }
+    if (customdata_layer_flag_load(layer) & CD_FLAG_NOFREE) {
+      /* Either a referenced layer which can't be shared, or another thread just shared it. */
+      return customdata_layer_sharing_load(layer);
+    }
+    CustomDataLayerSharing *new_sharing = MEM_new<CustomDataLayerSharing>(__func__);
+    /* The users are the source layer itself and the new layer. */
+    new_sharing->users = 2;
+    new_sharing->type = layer->type;
+    new_sharing->totelem = totelem;
+    new_sharing->data = layer->data;
+    sharing = static_cast<CustomDataLayerSharing *>(
+        atomic_cas_ptr(reinterpret_cast<void **>(&layer->sharing), nullptr, new_sharing));
+    if (sharing == nullptr) {
+      atomic_fetch_and_or_int32(&layer->flag, CD_FLAG_NOFREE);
+      return new_sharing;
+    }
+    /* Another thread shared the layer first. */
+    MEM_delete(new_sharing);
+  }
+  BLI_assert(sharing->data == layer->data);
+  sharing->users.fetch_add(1, std::memory_order_relaxed);
+  return sharing;
+}
+
+/**
+ * Take ownership of the data of a shared layer. The data is only copied when it is still used by
+ * other layers.
+ */
+static void customdata_sharing_make_mutable(CustomDataLayer *layer, const int totelem)
+{
+  CustomDataLayerSharing *sharing = layer->sharing;
+  if (sharing->users.load(std::memory_order_acquire) == 1) {
+    /* This is the last user, so the data can be reused directly. */
+    MEM_delete(sharing);
+  }
+  else {
+    const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+    void *dst_data = MEM_malloc_arrayN((size_t)totelem, typeInfo->size, "CD shared layer copy");
+    if (typeInfo->copy) {
+      typeInfo->copy(layer->data, dst_data, totelem);
+    }
+    else {
+      memcpy(dst_data, layer->data, (size_t)totelem * typeInfo->size);
+    }
+    layer->data = dst_data;
+    customdata_sharing_remove_user(sharing);
+  }
+  layer->sharing = nullptr;
+  layer->flag &= ~CD_FLAG_NOFREE;
+}
+
+/** \} */
+
 bool CustomData_merge(const struct CustomData *source,
                       struct CustomData *dest,
                       CustomDataMask mask,
@@ -2129,7 +2256,7 @@ bool CustomData_merge(const struct CustomData *source,
     // typeInfo = layerType_getInfo(layer->type); /* UNUSED */
 
     int type = layer->type;
-    int flag = layer->flag;
+    int flag = customdata_layer_flag_load(layer);
 
     if (type != lasttype) {
       number = 0;
@@ -2162,6 +2289,7 @@ bool CustomData_merge(const struct CustomData *source,
       case CD_ASSIGN:
       case CD_REFERENCE:
       case CD_DUPLICATE:
+      case CD_SHARE:
         data = layer->data;
         break;
       default:
@@ -2169,15 +2297,30 @@ bool CustomData_merge(const struct CustomData *source,
         break;
     }
 
-    if ((alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
+    /* Shared data must stay alive as long as it is referenced, so references to it are shared as
+     * well. Assigning a shared layer adds a user too, since callers keep using and freeing the
+     * source after assigning. */
+    CustomDataLayerSharing *sharing = nullptr;
+    eCDAllocType layer_alloctype = alloctype;
+    if (alloctype == CD_SHARE) {
+      sharing = customdata_sharing_add_user(layer, totelem, true);
+      layer_alloctype = sharing ? CD_REFERENCE : CD_DUPLICATE;
+    }
+    else if (ELEM(alloctype, CD_REFERENCE, CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
+      sharing = customdata_sharing_add_user(layer, totelem, false);
+    }
+
+    if ((layer_alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
       newlayer = customData_add_layer__internal(
           dest, type, CD_REFERENCE, data, totelem, layer->name);
     }
     else {
-      newlayer = customData_add_layer__internal(dest, type, alloctype, data, totelem, layer->name);
+      newlayer = customData_add_layer__internal(
+          dest, type, layer_alloctype, data, totelem, layer->name);
     }
 
     if (newlayer) {
+      newlayer->sharing = sharing;
       newlayer->uid = layer->uid;
 
       newlayer->active = lastactive;
@@ -2234,7 +2377,12 @@ static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
     BKE_anonymous_attribute_id_decrement_weak(layer->anonymous_id);
     layer->anonymous_id = nullptr;
   }
-  if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
+  CustomDataLayerSharing *sharing = customdata_layer_sharing_load(layer);
+  if (sharing != nullptr) {
+    customdata_sharing_remove_user(sharing);
+    layer->sharing = nullptr;
+  }
+  if (!(customdata_layer_flag_load(layer) & CD_FLAG_NOFREE) && layer->data) {
     typeInfo = layerType_getInfo(layer->type);
 
     if (typeInfo->free) {
@@ -2810,7 +2958,10 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
-  if (layer->flag & CD_FLAG_NOFREE) {
+  if (customdata_layer_sharing_load(layer) != nullptr) {
+    customdata_sharing_make_mutable(layer, totelem);
+  }
+  else if (customdata_layer_flag_load(layer) & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
      * So in case a custom copy function is defined, use it!
@@ -2895,7 +3046,7 @@ bool CustomData_is_referenced_layer(struct CustomData *data, int type)
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
-  return (layer->flag & CD_FLAG_NOFREE) != 0;
+  return (customdata_layer_flag_load(layer) & CD_FLAG_NOFREE) != 0;
 }
 
 void CustomData_free_temporary(CustomData *data, int totelem)
@@ -5166,6 +5317,7 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, int count)
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+    layer->sharing = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
       BLO_read_data_address(reader, &layer->data);
@@ -0,0 +1,124 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_customdata_types.h"
+
+#include "BKE_customdata.h"
+
+namespace blender::bke::tests {
+
+static const int ELEMS_NUM = 16;
+
+class CustomDataSharingTest : public testing::Test {
+ protected:
+  CustomData src;
+  unsigned int blocks_in_use;
+
+  void SetUp() override
+  {
+    blocks_in_use = MEM_get_memory_blocks_in_use();
+    CustomData_reset(&src);
+    float *data = static_cast<float *>(
+        CustomData_add_layer(&src, CD_PROP_FLOAT, CD_CALLOC, nullptr, ELEMS_NUM));
+    for (int i = 0; i < ELEMS_NUM; i++) {
+      data[i] = float(i);
+    }
+  }
+
+  void TearDown() override
+  {
+    /* Every shared array is freed exactly once, by its last user. */
+    EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_in_use);
+  }
+
+  static void expect_values(const CustomData &data)
+  {
+    const float *values = static_cast<const float *>(CustomData_get_layer(&data, CD_PROP_FLOAT));
+    ASSERT_NE(values, nullptr);
+    for (int i = 0; i < ELEMS_NUM; i++) {
+      EXPECT_EQ(values[i], float(i));
+    }
+  }
+};
+
+TEST_F(CustomDataSharingTest, share_then_free)
+{
+  CustomData dst;
+  CustomData_copy(&src, &dst, CD_MASK_PROP_FLOAT, CD_SHARE, ELEMS_NUM);
+  EXPECT_EQ(CustomData_get_layer(&dst, CD_PROP_FLOAT), CustomData_get_layer(&src, CD_PROP_FLOAT));
+  EXPECT_TRUE(CustomData_is_referenced_layer(&src, CD_PROP_FLOAT));
+  EXPECT_TRUE(CustomData_is_referenced_layer(&dst, CD_PROP_FLOAT));
+
+  /* The data stays alive until the last user is freed. */
+  CustomData_free(&src, ELEMS_NUM);
+  expect_values(dst);
+  CustomData_free(&dst, ELEMS_NUM);
+}
+
+TEST_F(CustomDataSharingTest, assign_then_free_both)
+{
+  CustomData shared;
+  CustomData_copy(&src, &shared, CD_MASK_PROP_FLOAT, CD_SHARE, ELEMS_NUM);
+
+  /* Assigning a shared layer adds a user, the source is still used and freed afterwards. */
+  CustomData dst;
+  CustomData_copy(&shared, &dst, CD_MASK_PROP_FLOAT, CD_ASSIGN, ELEMS_NUM);
+  expect_values(shared);
+  CustomData_free(&shared, ELEMS_NUM);
+  CustomData_free(&src, ELEMS_NUM);
+  expect_values(dst);
+  CustomData_free(&dst, ELEMS_NUM);
+}
+
+TEST_F(CustomDataSharingTest, assign_then_free_both_reversed)
+{
+  CustomData shared;
+  CustomData_copy(&src, &shared, CD_MASK_PROP_FLOAT, CD_SHARE, ELEMS_NUM);
+
+  CustomData dst;
+  CustomData_copy(&shared, &dst, CD_MASK_PROP_FLOAT, CD_ASSIGN, ELEMS_NUM);
+  CustomData_free(&dst, ELEMS_NUM);
+  CustomData_free(&src, ELEMS_NUM);
+  expect_values(shared);
+  CustomData_free(&shared, ELEMS_NUM);
+}
+
+TEST_F(CustomDataSharingTest, copy_on_write)
+{
+  CustomData dst;
+  CustomData_copy(&src, &dst, CD_MASK_PROP_FLOAT, CD_SHARE, ELEMS_NUM);
+
+  /* Writing to a layer that is still used elsewhere makes a copy. */
+  float *dst_values = static_cast<float *>(
+      CustomData_duplicate_referenced_layer(&dst, CD_PROP_FLOAT, ELEMS_NUM));
+  EXPECT_NE(dst_values, CustomData_get_layer(&src, CD_PROP_FLOAT));
+  EXPECT_FALSE(CustomData_is_referenced_layer(&dst, CD_PROP_FLOAT));
+  dst_values[0] = -1.0f;
+  expect_values(src);
+
+  /* The last user takes ownership of the data without copying. */
+  const void *src_values = CustomData_get_layer(&src, CD_PROP_FLOAT);
+  EXPECT_EQ(CustomData_duplicate_referenced_layer(&src, CD_PROP_FLOAT, ELEMS_NUM), src_values);
+  EXPECT_FALSE(CustomData_is_referenced_layer(&src, CD_PROP_FLOAT));
+
+  CustomData_free(&src, ELEMS_NUM);
+  CustomData_free(&dst, ELEMS_NUM);
+}
+
+}  // namespace blender::bke::tests
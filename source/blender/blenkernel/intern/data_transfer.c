@@ -362,6 +362,8 @@ static void data_transfer_dtdata_type_postprocess(Object *UNUSED(ob_src),
                                      poly_nors_dst,
                                      num_polys_dst,
                                      custom_nors_dst);
+    /* The loop normal layer contains the transferred normals now, not the split normals. */
+    BKE_mesh_loop_normals_tag_dirty(me_dst);
   }
 }
 
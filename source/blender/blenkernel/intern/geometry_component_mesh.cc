@@ -49,7 +49,7 @@ GeometryComponent *MeshComponent::copy() const
 {
   MeshComponent *new_component = new MeshComponent();
   if (mesh_ != nullptr) {
-    new_component->mesh_ = BKE_mesh_copy_for_eval(mesh_, false);
+    new_component->mesh_ = BKE_mesh_copy_for_eval_shared(mesh_);
     new_component->ownership_ = GeometryOwnershipType::Owned;
   }
   return new_component;
@@ -96,7 +96,7 @@ Mesh *MeshComponent::get_for_write()
 {
   BLI_assert(this->is_mutable());
   if (ownership_ == GeometryOwnershipType::ReadOnly) {
-    mesh_ = BKE_mesh_copy_for_eval(mesh_, false);
+    mesh_ = BKE_mesh_copy_for_eval_shared(mesh_);
     ownership_ = GeometryOwnershipType::Owned;
   }
   return mesh_;
@@ -116,7 +116,7 @@ void MeshComponent::ensure_owns_direct_data()
 {
   BLI_assert(this->is_mutable());
   if (ownership_ != GeometryOwnershipType::Owned) {
-    mesh_ = BKE_mesh_copy_for_eval(mesh_, false);
+    mesh_ = BKE_mesh_copy_for_eval_shared(mesh_);
     ownership_ = GeometryOwnershipType::Owned;
   }
 }
@@ -898,6 +898,14 @@ static void tag_normals_dirty_when_writing_position(GeometryComponent &component
   }
 }
 
+static void tag_loop_normals_dirty_when_writing(GeometryComponent &component)
+{
+  Mesh *mesh = get_mesh_from_component_for_write(component);
+  if (mesh != nullptr) {
+    BKE_mesh_loop_normals_tag_dirty(mesh);
+  }
+}
+
 static int get_material_index(const MPoly &mpoly)
 {
   return static_cast<int>(mpoly.mat_nr);
@@ -1240,7 +1248,7 @@ static ComponentAttributeProviders create_attribute_providers_for_mesh()
       face_access,
       make_derived_read_attribute<MPoly, bool, get_shade_smooth>,
       make_derived_write_attribute<MPoly, bool, get_shade_smooth, set_shade_smooth>,
-      nullptr);
+      tag_loop_normals_dirty_when_writing);
 
   static BuiltinCustomDataLayerProvider crease(
       "crease",
@@ -136,7 +136,13 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
 
   BKE_defgroup_copy_list(&mesh_dst->vertex_group_names, &mesh_src->vertex_group_names);
 
-  const eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
+  eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
+  if ((flag & LIB_ID_COPY_CD_SHARE) && (mesh_src->id.tag & LIB_TAG_NO_MAIN) &&
+      (mesh_src->id.tag & LIB_TAG_COPIED_ON_WRITE) == 0) {
+    /* Only evaluated meshes are shared. Original and copy-on-write meshes can be modified in
+     * place without taking referenced layers into account. */
+    alloc_type = CD_SHARE;
+  }
   CustomData_copy(&mesh_src->vdata, &mesh_dst->vdata, mask.vmask, alloc_type, mesh_dst->totvert);
   CustomData_copy(&mesh_src->edata, &mesh_dst->edata, mask.emask, alloc_type, mesh_dst->totedge);
   CustomData_copy(&mesh_src->ldata, &mesh_dst->ldata, mask.lmask, alloc_type, mesh_dst->totloop);
@@ -163,6 +169,10 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
    * could be copied as the cost would be much lower. */
   BKE_mesh_normals_tag_dirty(mesh_dst);
 
+  /* The positions are the same, so the triangulation can be reused while the topology is shared
+   * with the source mesh. */
+  BKE_mesh_runtime_looptri_share(mesh_dst, mesh_src);
+
   /* TODO: Do we want to add flag to prevent this? */
   if (mesh_src->key && (flag & LIB_ID_COPY_SHAPEKEY)) {
     BKE_id_copy_ex(bmain, &mesh_src->key->id, (ID **)&mesh_dst->key, flag);
@@ -1156,6 +1166,12 @@ Mesh *BKE_mesh_copy_for_eval(const Mesh *source, bool reference)
   return result;
 }
 
+Mesh *BKE_mesh_copy_for_eval_shared(const Mesh *source)
+{
+  return (Mesh *)BKE_id_copy_ex(
+      nullptr, &source->id, nullptr, LIB_ID_COPY_LOCALIZE | LIB_ID_COPY_CD_SHARE);
+}
+
 BMesh *BKE_mesh_to_bmesh_ex(const Mesh *me,
                             const struct BMeshCreateParams *create_params,
                             const struct BMeshFromMeshParams *convert_params)
@@ -1561,6 +1577,7 @@ void BKE_mesh_smooth_flag_set(Mesh *me, const bool use_smooth)
       me->mpoly[i].flag &= ~ME_SMOOTH;
     }
   }
+  BKE_mesh_loop_normals_tag_dirty(me);
 }
 
 int poly_find_loop_from_vert(const MPoly *poly, const MLoop *loopstart, uint vert)
@@ -1927,8 +1944,14 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
                                  ((mesh->flag & ME_AUTOSMOOTH) != 0);
   const float split_angle = (mesh->flag & ME_AUTOSMOOTH) != 0 ? mesh->smoothresh : (float)M_PI;
 
+  if (r_lnors_spacearr == nullptr && !BKE_mesh_loop_normals_are_dirty(mesh)) {
+    /* Positions, topology and custom normals haven't changed since the last calculation. */
+    return;
+  }
+
   if (CustomData_has_layer(&mesh->ldata, CD_NORMAL)) {
-    r_loopnors = (float(*)[3])CustomData_get_layer(&mesh->ldata, CD_NORMAL);
+    r_loopnors = (float(*)[3])CustomData_duplicate_referenced_layer(
+        &mesh->ldata, CD_NORMAL, mesh->totloop);
     memset(r_loopnors, 0, sizeof(float[3]) * mesh->totloop);
   }
   else {
@@ -1959,7 +1982,14 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
 
   BKE_mesh_assert_normals_dirty_or_calculated(mesh);
 
-  mesh->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
+  /* Requesting the loop normal spaces forces split normals, the result only matches the mesh
+   * settings when auto smooth is enabled. */
+  if (use_split_normals == ((mesh->flag & ME_AUTOSMOOTH) != 0)) {
+    mesh->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
+  }
+  else {
+    mesh->runtime.cd_dirty_loop |= CD_MASK_NORMAL;
+  }
 }
 
 void BKE_mesh_calc_normals_split(Mesh *mesh)
@@ -1486,6 +1486,7 @@ void BKE_mesh_nomain_to_mesh(Mesh *mesh_src,
 
   tmp.runtime.cd_dirty_poly = mesh_src->runtime.cd_dirty_poly;
   tmp.runtime.cd_dirty_vert = mesh_src->runtime.cd_dirty_vert;
+  tmp.runtime.cd_dirty_loop = mesh_src->runtime.cd_dirty_loop;
 
   /* Ensure that when no normal layers exist, they are marked dirty, because
    * normals might not have been included in the mask of copied layers. */
@@ -26,6 +26,7 @@
  */
 
 #include <climits>
+#include <mutex>
 
 #include "MEM_guardedalloc.h"
 
@@ -43,15 +44,19 @@
 #include "BLI_span.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_editmesh_cache.h"
 #include "BKE_global.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_runtime.h"
 
 #include "atomic_ops.h"
 
+using blender::IndexRange;
 using blender::Span;
 
 // #define DEBUG_TIME
@@ -111,6 +116,14 @@ void BKE_mesh_normals_tag_dirty(Mesh *mesh)
 {
   mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
   mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_loop |= CD_MASK_NORMAL;
+  /* Positions changed, which also affects the triangulation of quads and n-gons. */
+  BKE_mesh_runtime_looptri_tag_positions_dirty(mesh);
+}
+
+void BKE_mesh_loop_normals_tag_dirty(Mesh *mesh)
+{
+  mesh->runtime.cd_dirty_loop |= CD_MASK_NORMAL;
 }
 
 float (*BKE_mesh_vertex_normals_for_write(Mesh *mesh))[3]
@@ -149,6 +162,12 @@ bool BKE_mesh_poly_normals_are_dirty(const Mesh *mesh)
   return mesh->runtime.cd_dirty_poly & CD_MASK_NORMAL;
 }
 
+bool BKE_mesh_loop_normals_are_dirty(const Mesh *mesh)
+{
+  return (mesh->runtime.cd_dirty_loop & CD_MASK_NORMAL) ||
+         !CustomData_has_layer(&mesh->ldata, CD_NORMAL);
+}
+
 void BKE_mesh_assert_normals_dirty_or_calculated(const Mesh *mesh)
 {
   if (!(mesh->runtime.cd_dirty_vert & CD_MASK_NORMAL)) {
@@ -820,6 +839,9 @@ struct LoopSplitTaskDataCommon {
   const float (*polynors)[3];
   const float (*vert_normals)[3];
 
+  /* Loops which are known to not be the entry point of a smooth fan, written atomically. */
+  BLI_bitmap *skip_loops;
+
   int numEdges;
   int numLoops;
   int numPolys;
@@ -1312,42 +1334,30 @@ static void loop_split_worker_do(LoopSplitTaskDataCommon *common_data,
   }
 }
 
-static void loop_split_worker(TaskPool *__restrict pool, void *taskdata)
+/**
+ * Add loops to the loops that are skipped by #loop_split_generator, from any thread.
+ */
+static void loop_split_skip_loops_enable(BLI_bitmap *skip_loops, const Span<int> loops)
 {
-  LoopSplitTaskDataCommon *common_data = (LoopSplitTaskDataCommon *)BLI_task_pool_user_data(pool);
-  LoopSplitTaskData *data = (LoopSplitTaskData *)taskdata;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr. */
-  BLI_Stack *edge_vectors = common_data->lnors_spacearr ?
-                                BLI_stack_new(sizeof(float[3]), __func__) :
-                                nullptr;
-
-#ifdef DEBUG_TIME
-  TIMEIT_START_AVERAGED(loop_split_worker);
-#endif
-
-  for (int i = 0; i < LOOP_SPLIT_TASK_BLOCK_SIZE; i++, data++) {
-    /* A nullptr ml_curr is used to tag ended data! */
-    if (data->ml_curr == nullptr) {
-      break;
-    }
-
-    loop_split_worker_do(common_data, data, edge_vectors);
+  for (const int loop : loops) {
+    atomic_fetch_and_or_uint32((uint32_t *)&skip_loops[loop >> _BITMAP_POWER],
+                               1u << (loop & _BITMAP_MASK));
   }
-
-  if (edge_vectors) {
-    BLI_stack_free(edge_vectors);
-  }
-
-#ifdef DEBUG_TIME
-  TIMEIT_END_AVERAGED(loop_split_worker);
-#endif
 }
 
 /**
- * Check whether given loop is part of an unknown-so-far cyclic smooth fan, or not.
+ * Check whether given loop is the entry point of a cyclic smooth fan, or not.
  * Needed because cyclic smooth fans have no obvious 'entry point',
  * and yet we need to walk them once, and only once.
+ *
+ * Loops are checked independently from each other, so that polygons can be processed in
+ * parallel. The entry point is the loop of the fan that comes first when iterating over polygons
+ * and their loops in order, this keeps the reference vectors of the fans' loop normal spaces (and
+ * therefore the meaning of custom normals) stable.
+ *
+ * Once a walk knows that none of the loops it visited is an entry point, they are added to
+ * `skip_loops`. Other walks stop when they reach a skipped loop, so that every fan is only walked
+ * a few times in total.
  */
 static bool loop_split_generator_check_cyclic_smooth_fan(const MLoop *mloops,
                                                          const MPoly *mpolys,
@@ -1383,8 +1393,15 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const MLoop *mloops,
   BLI_assert(mlfan_vert_index >= 0);
   BLI_assert(mpfan_curr_index >= 0);
 
-  BLI_assert(!BLI_BITMAP_TEST(skip_loops, mlfan_vert_index));
-  BLI_BITMAP_ENABLE(skip_loops, mlfan_vert_index);
+  blender::Vector<int, 32> fan_loops = {ml_curr_index};
+
+  /* Degenerate geometry may lead to a walk that cycles without ever getting back to the initial
+   * loop. That is detected by comparing with a checkpoint that is moved after a doubling number
+   * of steps, so a walk never takes more than a few times the number of loops around the vertex. */
+  int checkpoint_curr_index = mlfan_curr_index;
+  int checkpoint_vert_index = mlfan_vert_index;
+  int checkpoint_steps = 1;
+  int steps = 0;
 
   while (true) {
     /* Find next loop of the smooth fan. */
@@ -1402,25 +1419,46 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const MLoop *mloops,
 
     if (IS_EDGE_SHARP(e2lfan_curr)) {
       /* Sharp loop/edge, so not a cyclic smooth fan. */
+      loop_split_skip_loops_enable(skip_loops, fan_loops);
       return false;
     }
     /* Smooth loop/edge. */
+    if (mlfan_vert_index == ml_curr_index) {
+      /* We walked around a whole cyclic smooth fan without finding any loop that comes first,
+       * means we can use initial `ml_curr` / `ml_prev` edge as start for this smooth fan. */
+      loop_split_skip_loops_enable(skip_loops, fan_loops);
+      return true;
+    }
+    /* The bitmap may be written by other threads, reading an outdated value only means that the
+     * walk continues a bit longer. */
     if (BLI_BITMAP_TEST(skip_loops, mlfan_vert_index)) {
-      if (mlfan_vert_index == ml_curr_index) {
-        /* We walked around a whole cyclic smooth fan without finding any already-processed loop,
-         * means we can use initial `ml_curr` / `ml_prev` edge as start for this smooth fan. */
-        return true;
-      }
-      /* Already checked in some previous looping, we can abort. */
+      /* Part of a fan that isn't cyclic or that is already processed from its entry point. */
+      loop_split_skip_loops_enable(skip_loops, fan_loops);
+      return false;
+    }
+    if (mpfan_curr_index < mp_curr_index ||
+        (mpfan_curr_index == mp_curr_index && mlfan_vert_index < ml_curr_index)) {
+      /* The fan is processed from another loop. The visited loops can't be skipped, since the walk
+       * from that loop still has to get past them. */
+      return false;
+    }
+    if (mlfan_curr_index == checkpoint_curr_index && mlfan_vert_index == checkpoint_vert_index) {
+      /* The walk cycles without the initial loop. Like in the case above, a walk from one of the
+       * visited loops may still get around the fan. */
       return false;
     }
+    if (++steps == checkpoint_steps) {
+      checkpoint_curr_index = mlfan_curr_index;
+      checkpoint_vert_index = mlfan_vert_index;
+      checkpoint_steps *= 2;
+      steps = 0;
+    }
 
-    /* We can skip it in future, and keep checking the smooth fan. */
-    BLI_BITMAP_ENABLE(skip_loops, mlfan_vert_index);
+    fan_loops.append(mlfan_vert_index);
   }
 }
 
-static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common_data)
+static void loop_split_generator(LoopSplitTaskDataCommon *common_data, const IndexRange polys)
 {
   MLoopNorSpaceArray *lnors_spacearr = common_data->lnors_spacearr;
   float(*loopnors)[3] = common_data->loopnors;
@@ -1429,65 +1467,35 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
   const MPoly *mpolys = common_data->mpolys;
   const int *loop_to_poly = common_data->loop_to_poly;
   const int(*edge_to_loops)[2] = common_data->edge_to_loops;
-  const int numLoops = common_data->numLoops;
-  const int numPolys = common_data->numPolys;
-
-  const MPoly *mp;
-  int mp_index;
-
-  const MLoop *ml_curr;
-  const MLoop *ml_prev;
-  int ml_curr_index;
-  int ml_prev_index;
-
-  BLI_bitmap *skip_loops = BLI_BITMAP_NEW(numLoops, __func__);
+  BLI_bitmap *skip_loops = common_data->skip_loops;
 
-  LoopSplitTaskData *data_buff = nullptr;
-  int data_idx = 0;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr
-   * (and we are not multi-threading). */
-  BLI_Stack *edge_vectors = nullptr;
+  /* Temp edge vectors stack, only used when computing lnor spacearr. */
+  BLI_Stack *edge_vectors = lnors_spacearr ? BLI_stack_new(sizeof(float[3]), __func__) : nullptr;
 
 #ifdef DEBUG_TIME
   TIMEIT_START_AVERAGED(loop_split_generator);
 #endif
 
-  if (!pool) {
-    if (lnors_spacearr) {
-      edge_vectors = BLI_stack_new(sizeof(float[3]), __func__);
-    }
-  }
-
   /* We now know edges that can be smoothed (with their vector, and their two loops),
    * and edges that will be hard! Now, time to generate the normals.
    */
-  for (mp = mpolys, mp_index = 0; mp_index < numPolys; mp++, mp_index++) {
-    float(*lnors)[3];
+  for (const int mp_index : polys) {
+    const MPoly *mp = &mpolys[mp_index];
     const int ml_last_index = (mp->loopstart + mp->totloop) - 1;
-    ml_curr_index = mp->loopstart;
-    ml_prev_index = ml_last_index;
+    int ml_curr_index = mp->loopstart;
+    int ml_prev_index = ml_last_index;
 
-    ml_curr = &mloops[ml_curr_index];
-    ml_prev = &mloops[ml_prev_index];
-    lnors = &loopnors[ml_curr_index];
+    const MLoop *ml_curr = &mloops[ml_curr_index];
+    const MLoop *ml_prev = &mloops[ml_prev_index];
+    float(*lnors)[3] = &loopnors[ml_curr_index];
 
     for (; ml_curr_index <= ml_last_index; ml_curr++, ml_curr_index++, lnors++) {
       const int *e2l_curr = edge_to_loops[ml_curr->e];
       const int *e2l_prev = edge_to_loops[ml_prev->e];
 
-#if 0
-      printf("Checking loop %d / edge %u / vert %u (sharp edge: %d, skiploop: %d)",
-             ml_curr_index,
-             ml_curr->e,
-             ml_curr->v,
-             IS_EDGE_SHARP(e2l_curr),
-             BLI_BITMAP_TEST_BOOL(skip_loops, ml_curr_index));
-#endif
-
       /* A smooth edge, we have to check for cyclic smooth fan case.
-       * If we find a new, never-processed cyclic smooth fan, we can do it now using that loop/edge
-       * as 'entry point', otherwise we can skip it. */
+       * If this loop is the entry point of a cyclic smooth fan, we can do it now using that
+       * loop/edge, otherwise we can skip it. */
 
       /* NOTE: In theory, we could make #loop_split_generator_check_cyclic_smooth_fan() store
        * mlfan_vert_index'es and edge indexes in two stacks, to avoid having to fan again around
@@ -1510,34 +1518,22 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
         // printf("SKIPPING!\n");
       }
       else {
-        LoopSplitTaskData *data, data_local;
+        LoopSplitTaskData data = {nullptr};
 
         // printf("PROCESSING!\n");
 
-        if (pool) {
-          if (data_idx == 0) {
-            data_buff = (LoopSplitTaskData *)MEM_calloc_arrayN(
-                LOOP_SPLIT_TASK_BLOCK_SIZE, sizeof(*data_buff), __func__);
-          }
-          data = &data_buff[data_idx];
-        }
-        else {
-          data = &data_local;
-          memset(data, 0, sizeof(*data));
-        }
-
         if (IS_EDGE_SHARP(e2l_curr) && IS_EDGE_SHARP(e2l_prev)) {
-          data->lnor = lnors;
-          data->ml_curr = ml_curr;
-          data->ml_prev = ml_prev;
-          data->ml_curr_index = ml_curr_index;
+          data.lnor = lnors;
+          data.ml_curr = ml_curr;
+          data.ml_prev = ml_prev;
+          data.ml_curr_index = ml_curr_index;
 #if 0 /* Not needed for 'single' loop. */
-          data->ml_prev_index = ml_prev_index;
-          data->e2l_prev = nullptr; /* Tag as 'single' task. */
+          data.ml_prev_index = ml_prev_index;
+          data.e2l_prev = nullptr; /* Tag as 'single' task. */
 #endif
-          data->mp_index = mp_index;
+          data.mp_index = mp_index;
           if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
+            data.lnor_space = BKE_lnor_space_create(lnors_spacearr);
           }
         }
         /* We *do not need* to check/tag loops as already computed!
@@ -1551,29 +1547,20 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
          */
         else {
 #if 0 /* Not needed for 'fan' loops. */
-          data->lnor = lnors;
+          data.lnor = lnors;
 #endif
-          data->ml_curr = ml_curr;
-          data->ml_prev = ml_prev;
-          data->ml_curr_index = ml_curr_index;
-          data->ml_prev_index = ml_prev_index;
-          data->e2l_prev = e2l_prev; /* Also tag as 'fan' task. */
-          data->mp_index = mp_index;
+          data.ml_curr = ml_curr;
+          data.ml_prev = ml_prev;
+          data.ml_curr_index = ml_curr_index;
+          data.ml_prev_index = ml_prev_index;
+          data.e2l_prev = e2l_prev; /* Also tag as 'fan' task. */
+          data.mp_index = mp_index;
           if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
+            data.lnor_space = BKE_lnor_space_create(lnors_spacearr);
           }
         }
 
-        if (pool) {
-          data_idx++;
-          if (data_idx == LOOP_SPLIT_TASK_BLOCK_SIZE) {
-            BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-            data_idx = 0;
-          }
-        }
-        else {
-          loop_split_worker_do(common_data, data, edge_vectors);
-        }
+        loop_split_worker_do(common_data, &data, edge_vectors);
       }
 
       ml_prev = ml_curr;
@@ -1581,22 +1568,45 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
     }
   }
 
-  /* Last block of data. Since it is calloc'ed and we use first nullptr item as stopper,
-   * everything is fine. */
-  if (pool && data_idx) {
-    BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-  }
-
   if (edge_vectors) {
     BLI_stack_free(edge_vectors);
   }
-  MEM_freeN(skip_loops);
 
 #ifdef DEBUG_TIME
   TIMEIT_END_AVERAGED(loop_split_generator);
 #endif
 }
 
+/**
+ * Generate and compute the loop normals of all fans, with polygons processed in parallel. Every
+ * fan is handled by the task that contains its entry loop, and since fans never share loops the
+ * tasks write to distinct elements of the output arrays.
+ */
+static void loop_split_generator_parallel(LoopSplitTaskDataCommon *common_data)
+{
+  MLoopNorSpaceArray *lnors_spacearr = common_data->lnors_spacearr;
+  std::mutex lnors_spacearr_mutex;
+
+  blender::threading::parallel_for(
+      IndexRange(common_data->numPolys), LOOP_SPLIT_TASK_BLOCK_SIZE, [&](const IndexRange range) {
+        if (lnors_spacearr == nullptr) {
+          loop_split_generator(common_data, range);
+          return;
+        }
+
+        /* Loop normal spaces are allocated from a #MemArena, which is not thread-safe. */
+        MLoopNorSpaceArray lnors_spacearr_tls;
+        BKE_lnor_spacearr_tls_init(lnors_spacearr, &lnors_spacearr_tls);
+
+        LoopSplitTaskDataCommon common_data_tls = *common_data;
+        common_data_tls.lnors_spacearr = &lnors_spacearr_tls;
+        loop_split_generator(&common_data_tls, range);
+
+        std::lock_guard lock{lnors_spacearr_mutex};
+        BKE_lnor_spacearr_tls_join(lnors_spacearr, &lnors_spacearr_tls);
+      });
+}
+
 void BKE_mesh_normals_loop_split(const MVert *mverts,
                                  const float (*vert_normals)[3],
                                  const int UNUSED(numVerts),
@@ -1700,6 +1710,7 @@ void BKE_mesh_normals_loop_split(const MVert *mverts,
   common_data.loop_to_poly = loop_to_poly;
   common_data.polynors = polynors;
   common_data.vert_normals = vert_normals;
+  common_data.skip_loops = BLI_BITMAP_NEW(numLoops, __func__);
   common_data.numEdges = numEdges;
   common_data.numLoops = numLoops;
   common_data.numPolys = numPolys;
@@ -1709,18 +1720,13 @@ void BKE_mesh_normals_loop_split(const MVert *mverts,
 
   if (numLoops < LOOP_SPLIT_TASK_BLOCK_SIZE * 8) {
     /* Not enough loops to be worth the whole threading overhead. */
-    loop_split_generator(nullptr, &common_data);
+    loop_split_generator(&common_data, IndexRange(numPolys));
   }
   else {
-    TaskPool *task_pool = BLI_task_pool_create(&common_data, TASK_PRIORITY_HIGH);
-
-    loop_split_generator(task_pool, &common_data);
-
-    BLI_task_pool_work_and_wait(task_pool);
-
-    BLI_task_pool_free(task_pool);
+    loop_split_generator_parallel(&common_data);
   }
 
+  MEM_freeN(common_data.skip_loops);
   MEM_freeN(edge_to_loops);
   if (!r_loop_to_poly) {
     MEM_freeN(loop_to_poly);
@@ -2070,6 +2076,8 @@ static void mesh_set_custom_normals(Mesh *mesh, float (*r_custom_nors)[3], const
                                mesh->totpoly,
                                clnors,
                                use_vertices);
+
+  BKE_mesh_loop_normals_tag_dirty(mesh);
 }
 
 void BKE_mesh_set_custom_normals(Mesh *mesh, float (*r_custom_loopnors)[3])
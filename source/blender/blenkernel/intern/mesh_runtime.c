@@ -84,12 +84,17 @@ static void mesh_runtime_free_mutexes(Mesh *mesh)
 void BKE_mesh_runtime_init_data(Mesh *mesh)
 {
   mesh_runtime_init_mutexes(mesh);
+  mesh->runtime.topology_cache = BKE_mesh_topology_cache_create();
 }
 
 void BKE_mesh_runtime_free_data(Mesh *mesh)
 {
   BKE_mesh_runtime_clear_cache(mesh);
   mesh_runtime_free_mutexes(mesh);
+  if (mesh->runtime.topology_cache != NULL) {
+    BKE_mesh_topology_cache_free(mesh->runtime.topology_cache);
+    mesh->runtime.topology_cache = NULL;
+  }
 }
 
 void BKE_mesh_runtime_reset_on_copy(Mesh *mesh, const int UNUSED(flag))
@@ -103,6 +108,7 @@ void BKE_mesh_runtime_reset_on_copy(Mesh *mesh, const int UNUSED(flag))
   memset(&runtime->looptris, 0, sizeof(runtime->looptris));
   runtime->bvh_cache = NULL;
   runtime->shrinkwrap_data = NULL;
+  runtime->topology_cache = BKE_mesh_topology_cache_create();
 
   mesh_runtime_init_mutexes(mesh);
 }
@@ -153,8 +159,73 @@ static void mesh_ensure_looptri_data(Mesh *mesh)
   }
 }
 
+/**
+ * Owner of a #MLoopTri array that is used by multiple meshes. The topology it was calculated
+ * for is stored as well, so that it isn't used anymore when a mesh stopped referencing it.
+ */
+typedef struct MeshLoopTriSharing {
+  int users;
+  int totloop;
+  int totpoly;
+  const MLoop *mloop;
+  const MPoly *mpoly;
+} MeshLoopTriSharing;
+
+static void mesh_runtime_looptri_free(Mesh *mesh)
+{
+  struct MLoopTri_Store *looptris = &mesh->runtime.looptris;
+  if (looptris->sharing != NULL) {
+    if (atomic_sub_and_fetch_int32(&looptris->sharing->users, 1) == 0) {
+      MEM_freeN(looptris->array);
+      MEM_freeN(looptris->sharing);
+    }
+    looptris->array = NULL;
+    looptris->sharing = NULL;
+    /* The allocation was never owned, don't try to reuse it. */
+    looptris->len_alloc = 0;
+  }
+  else {
+    MEM_SAFE_FREE(looptris->array);
+  }
+  looptris->positions_dirty = false;
+}
+
+static bool mesh_runtime_looptri_sharing_matches(const MeshLoopTriSharing *sharing,
+                                                 const Mesh *mesh)
+{
+  return sharing->mloop == mesh->mloop && sharing->mpoly == mesh->mpoly &&
+         sharing->totloop == mesh->totloop && sharing->totpoly == mesh->totpoly;
+}
+
+/* Make sure the array is only used by this mesh, so that it can be updated in place. */
+static void mesh_runtime_looptri_make_mutable(Mesh *mesh)
+{
+  struct MLoopTri_Store *looptris = &mesh->runtime.looptris;
+  MeshLoopTriSharing *sharing = looptris->sharing;
+  if (sharing == NULL) {
+    return;
+  }
+  /* Other users can only remove themselves meanwhile, adding a user requires the mutex of a mesh
+   * which uses the array, which is held by the caller when this is the only user. */
+  if (atomic_add_and_fetch_int32(&sharing->users, 0) == 1) {
+    MEM_freeN(sharing);
+    looptris->sharing = NULL;
+    looptris->len_alloc = looptris->len;
+    return;
+  }
+  MLoopTri *array = MEM_dupallocN(looptris->array);
+  const bool positions_dirty = looptris->positions_dirty;
+  mesh_runtime_looptri_free(mesh);
+  looptris->array = array;
+  looptris->len_alloc = looptris->len;
+  looptris->positions_dirty = positions_dirty;
+}
+
 void BKE_mesh_runtime_looptri_recalc(Mesh *mesh)
 {
+  if (mesh->runtime.looptris.sharing != NULL) {
+    mesh_runtime_looptri_free(mesh);
+  }
   mesh_ensure_looptri_data(mesh);
   BLI_assert(mesh->totpoly == 0 || mesh->runtime.looptris.array_wip != NULL);
 
@@ -170,6 +241,52 @@ void BKE_mesh_runtime_looptri_recalc(Mesh *mesh)
                  mesh->runtime.looptris.array,
                  mesh->runtime.looptris.array_wip);
   mesh->runtime.looptris.array_wip = NULL;
+  mesh->runtime.looptris.positions_dirty = false;
+}
+
+void BKE_mesh_runtime_looptri_tag_positions_dirty(Mesh *mesh)
+{
+  if (mesh->runtime.looptris.array != NULL) {
+    mesh->runtime.looptris.positions_dirty = true;
+  }
+}
+
+void BKE_mesh_runtime_looptri_share(Mesh *mesh_dst, const Mesh *mesh_src)
+{
+  BLI_assert(mesh_dst->runtime.looptris.array == NULL);
+  if (mesh_dst->mloop != mesh_src->mloop || mesh_dst->mpoly != mesh_src->mpoly ||
+      mesh_dst->totloop != mesh_src->totloop || mesh_dst->totpoly != mesh_src->totpoly) {
+    return;
+  }
+
+  /* The source mesh is logically const, its cache is protected by its mutex. */
+  Mesh *mesh = (Mesh *)mesh_src;
+  ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
+  BLI_mutex_lock(mesh_eval_mutex);
+
+  struct MLoopTri_Store *looptris = &mesh->runtime.looptris;
+  if (looptris->array != NULL) {
+    MeshLoopTriSharing *sharing = looptris->sharing;
+    if (sharing == NULL) {
+      sharing = MEM_mallocN(sizeof(MeshLoopTriSharing), __func__);
+      sharing->users = 1;
+      sharing->totloop = mesh->totloop;
+      sharing->totpoly = mesh->totpoly;
+      sharing->mloop = mesh->mloop;
+      sharing->mpoly = mesh->mpoly;
+      looptris->sharing = sharing;
+    }
+    atomic_add_and_fetch_int32(&sharing->users, 1);
+
+    struct MLoopTri_Store *looptris_dst = &mesh_dst->runtime.looptris;
+    looptris_dst->array = looptris->array;
+    looptris_dst->sharing = sharing;
+    looptris_dst->len = looptris->len;
+    looptris_dst->len_alloc = 0;
+    looptris_dst->positions_dirty = looptris->positions_dirty;
+  }
+
+  BLI_mutex_unlock(mesh_eval_mutex);
 }
 
 int BKE_mesh_runtime_looptri_len(const Mesh *mesh)
@@ -186,15 +303,39 @@ static void mesh_runtime_looptri_recalc_isolated(void *userdata)
   BKE_mesh_runtime_looptri_recalc(mesh);
 }
 
+static void mesh_runtime_looptri_update_positions_isolated(void *userdata)
+{
+  Mesh *mesh = userdata;
+  mesh_runtime_looptri_make_mutable(mesh);
+  BKE_mesh_recalc_looptri_for_positions(mesh->mloop,
+                                        mesh->mpoly,
+                                        mesh->mvert,
+                                        mesh->totloop,
+                                        mesh->totpoly,
+                                        mesh->runtime.looptris.array);
+  mesh->runtime.looptris.positions_dirty = false;
+}
+
 const MLoopTri *BKE_mesh_runtime_looptri_ensure(const Mesh *mesh)
 {
   ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
   BLI_mutex_lock(mesh_eval_mutex);
 
+  MeshLoopTriSharing *sharing = mesh->runtime.looptris.sharing;
+  if (sharing != NULL && !mesh_runtime_looptri_sharing_matches(sharing, mesh)) {
+    /* The topology of this mesh was changed since the array was shared. */
+    mesh_runtime_looptri_free((Mesh *)mesh);
+  }
+
   MLoopTri *looptri = mesh->runtime.looptris.array;
 
   if (looptri != NULL) {
     BLI_assert(BKE_mesh_runtime_looptri_len(mesh) == mesh->runtime.looptris.len);
+    if (mesh->runtime.looptris.positions_dirty) {
+      /* Only positions changed, the existing array can be updated in place. */
+      BLI_task_isolate(mesh_runtime_looptri_update_positions_isolated, (void *)mesh);
+      looptri = mesh->runtime.looptris.array;
+    }
   }
   else {
     /* Must isolate multithreaded tasks while holding a mutex lock. */
@@ -263,7 +404,10 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
     bvhcache_free(mesh->runtime.bvh_cache);
     mesh->runtime.bvh_cache = NULL;
   }
-  MEM_SAFE_FREE(mesh->runtime.looptris.array);
+  mesh_runtime_looptri_free(mesh);
+  if (mesh->runtime.topology_cache != NULL) {
+    BKE_mesh_topology_cache_clear(mesh->runtime.topology_cache);
+  }
   /* TODO(sergey): Does this really belong here? */
   if (mesh->runtime.subdiv_ccg != NULL) {
     BKE_subdiv_ccg_destroy(mesh->runtime.subdiv_ccg);
@@ -0,0 +1,112 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+
+#include "BKE_idtype.h"
+#include "BKE_lib_id.h"
+#include "BKE_mesh.h"
+#include "BKE_mesh_runtime.h"
+
+#include "BLI_array.hh"
+#include "BLI_math_vector.h"
+
+namespace blender::bke::tests {
+
+class MeshLoopTriSharingTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+
+  /* A single square quad, triangulated along the diagonal from its first to its third corner. */
+  static Mesh *create_quad_mesh()
+  {
+    Mesh *mesh = BKE_mesh_new_nomain(4, 0, 0, 4, 1);
+    const float positions[4][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    for (int i = 0; i < 4; i++) {
+      copy_v3_v3(mesh->mvert[i].co, positions[i]);
+      mesh->mloop[i].v = i;
+    }
+    mesh->mpoly[0].loopstart = 0;
+    mesh->mpoly[0].totloop = 4;
+    return mesh;
+  }
+
+  /* Move the last corner across the diagonal, so that the quad is split along the other one. */
+  static void make_quad_concave(Mesh *mesh)
+  {
+    float(*positions)[3] = BKE_mesh_vert_coords_alloc(mesh, nullptr);
+    positions[3][0] = 0.6f;
+    positions[3][1] = 0.4f;
+    BKE_mesh_vert_coords_apply(mesh, positions);
+    MEM_freeN(positions);
+  }
+
+  static void expect_looptris_up_to_date(const Mesh *mesh)
+  {
+    const MLoopTri *looptris = BKE_mesh_runtime_looptri_ensure(mesh);
+    Array<MLoopTri> expected(BKE_mesh_runtime_looptri_len(mesh));
+    BKE_mesh_recalc_looptri(
+        mesh->mloop, mesh->mpoly, mesh->mvert, mesh->totloop, mesh->totpoly, expected.data());
+    for (const int i : expected.index_range()) {
+      EXPECT_EQ(looptris[i].poly, expected[i].poly);
+      EXPECT_EQ(looptris[i].tri[0], expected[i].tri[0]);
+      EXPECT_EQ(looptris[i].tri[1], expected[i].tri[1]);
+      EXPECT_EQ(looptris[i].tri[2], expected[i].tri[2]);
+    }
+  }
+};
+
+TEST_F(MeshLoopTriSharingTest, copy_reuses_looptris)
+{
+  Mesh *mesh = create_quad_mesh();
+  const MLoopTri *looptris = BKE_mesh_runtime_looptri_ensure(mesh);
+
+  Mesh *copy = BKE_mesh_copy_for_eval_shared(mesh);
+  EXPECT_EQ(BKE_mesh_runtime_looptri_ensure(copy), looptris);
+
+  /* The array stays alive as long as a mesh uses it. */
+  BKE_id_free(nullptr, mesh);
+  expect_looptris_up_to_date(copy);
+  BKE_id_free(nullptr, copy);
+}
+
+TEST_F(MeshLoopTriSharingTest, deformed_copy_updates_own_looptris)
+{
+  Mesh *mesh = create_quad_mesh();
+  const MLoopTri *looptris = BKE_mesh_runtime_looptri_ensure(mesh);
+
+  Mesh *copy = BKE_mesh_copy_for_eval_shared(mesh);
+  make_quad_concave(copy);
+  EXPECT_NE(BKE_mesh_runtime_looptri_ensure(copy), looptris);
+  expect_looptris_up_to_date(copy);
+
+  /* The original is unaffected by the deformation of its copy. */
+  EXPECT_EQ(BKE_mesh_runtime_looptri_ensure(mesh), looptris);
+  expect_looptris_up_to_date(mesh);
+
+  BKE_id_free(nullptr, copy);
+  BKE_id_free(nullptr, mesh);
+}
+
+TEST_F(MeshLoopTriSharingTest, deformed_last_user_updates_in_place)
+{
+  Mesh *mesh = create_quad_mesh();
+  const MLoopTri *looptris = BKE_mesh_runtime_looptri_ensure(mesh);
+
+  Mesh *copy = BKE_mesh_copy_for_eval_shared(mesh);
+  BKE_id_free(nullptr, mesh);
+
+  make_quad_concave(copy);
+  EXPECT_EQ(BKE_mesh_runtime_looptri_ensure(copy), looptris);
+  expect_looptris_up_to_date(copy);
+  BKE_id_free(nullptr, copy);
+}
+
+}  // namespace blender::bke::tests
@@ -658,6 +658,18 @@ static void mesh_calc_tessellation_for_face_with_normal_fn(void *__restrict user
                                        data->poly_normals[index]);
 }
 
+static void mesh_calc_tessellation_for_face_positions_fn(void *__restrict userdata,
+                                                        const int index,
+                                                        const TaskParallelTLS *__restrict tls)
+{
+  const struct TessellationUserData *data = userdata;
+  /* The tessellation of a triangle doesn't depend on the vertex positions. */
+  if (data->mpoly[index].totloop == 3) {
+    return;
+  }
+  mesh_calc_tessellation_for_face_fn(userdata, index, tls);
+}
+
 static void mesh_calc_tessellation_for_face_free_fn(const void *__restrict UNUSED(userdata),
                                                     void *__restrict tls_v)
 {
@@ -735,4 +747,33 @@ void BKE_mesh_recalc_looptri_with_normals(const MLoop *mloop,
   }
 }
 
+void BKE_mesh_recalc_looptri_for_positions(const MLoop *mloop,
+                                           const MPoly *mpoly,
+                                           const MVert *mvert,
+                                           int totloop,
+                                           int totpoly,
+                                           MLoopTri *mlooptri)
+{
+  struct TessellationUserTLS tls_data_dummy = {NULL};
+
+  struct TessellationUserData data = {
+      .mloop = mloop,
+      .mpoly = mpoly,
+      .mvert = mvert,
+      .mlooptri = mlooptri,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (totloop >= MESH_FACE_TESSELLATE_THREADED_LIMIT);
+
+  settings.userdata_chunk = &tls_data_dummy;
+  settings.userdata_chunk_size = sizeof(tls_data_dummy);
+
+  settings.func_free = mesh_calc_tessellation_for_face_free_fn;
+
+  BLI_task_parallel_range(
+      0, totpoly, &data, mesh_calc_tessellation_for_face_positions_fn, &settings);
+}
+
 /** \} */
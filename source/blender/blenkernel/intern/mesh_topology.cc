@@ -0,0 +1,229 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup bke
+ */
+
+#include <atomic>
+#include <mutex>
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+
+#include "BLI_disjoint_set.hh"
+#include "BLI_task.hh"
+#include "BLI_vector_set.hh"
+
+#include "BKE_mesh_runtime.h"
+#include "BKE_mesh_topology.hh"
+
+namespace blender::bke::mesh_topology {
+
+/**
+ * A value that is computed the first time it is accessed. The computation happens while a mutex
+ * is locked, so that other threads accessing the same value wait for the result.
+ */
+template<typename T> struct LazyCacheItem {
+  std::mutex mutex;
+  std::atomic<bool> is_valid = false;
+  T data;
+
+  template<typename ComputeFn> const T &ensure(const ComputeFn &compute_fn)
+  {
+    if (is_valid.load(std::memory_order_acquire)) {
+      return data;
+    }
+    std::lock_guard lock{mutex};
+    if (!is_valid.load(std::memory_order_relaxed)) {
+      /* Isolate the computation, so that the thread holding the lock does not start working on
+       * unrelated tasks that may try to access the same cache. */
+      threading::isolate_task([&]() { compute_fn(data); });
+      is_valid.store(true, std::memory_order_release);
+    }
+    return data;
+  }
+
+  void clear()
+  {
+    is_valid.store(false, std::memory_order_relaxed);
+    data = T();
+  }
+};
+
+struct VertIslands {
+  Array<int> indices;
+  int islands_num = 0;
+};
+
+}  // namespace blender::bke::mesh_topology
+
+/** Stored in #Mesh_Runtime.topology_cache. */
+struct MeshTopologyCache {
+  blender::bke::mesh_topology::LazyCacheItem<blender::bke::mesh_topology::ElementMap> vert_to_edge;
+  blender::bke::mesh_topology::LazyCacheItem<blender::bke::mesh_topology::ElementMap> vert_to_poly;
+  blender::bke::mesh_topology::LazyCacheItem<blender::bke::mesh_topology::ElementMap> edge_to_poly;
+  blender::bke::mesh_topology::LazyCacheItem<blender::bke::mesh_topology::VertIslands>
+      vert_islands;
+};
+
+namespace blender::bke::mesh_topology {
+
+/**
+ * Build a map in compressed sparse row form. The #foreach_pair callback is called twice, once to
+ * count the group sizes and once to fill the groups. It calls the given function for every pair
+ * of source and destination element, in a deterministic order.
+ */
+template<typename ForeachPairFn>
+static void build_element_map(const int src_size,
+                              const ForeachPairFn &foreach_pair,
+                              ElementMap &r_map)
+{
+  r_map.offsets.reinitialize(src_size + 1);
+  r_map.offsets.fill(0);
+  foreach_pair([&](const int src_index, const int /*dst_index*/) { r_map.offsets[src_index]++; });
+
+  int offset = 0;
+  for (const int i : IndexRange(src_size)) {
+    const int group_size = r_map.offsets[i];
+    r_map.offsets[i] = offset;
+    offset += group_size;
+  }
+  r_map.offsets[src_size] = offset;
+
+  r_map.indices.reinitialize(offset);
+  Array<int> fill_counts(src_size, 0);
+  foreach_pair([&](const int src_index, const int dst_index) {
+    r_map.indices[r_map.offsets[src_index] + fill_counts[src_index]] = dst_index;
+    fill_counts[src_index]++;
+  });
+}
+
+static MeshTopologyCache &get_cache(const Mesh &mesh)
+{
+  BLI_assert(mesh.runtime.topology_cache != nullptr);
+  return *mesh.runtime.topology_cache;
+}
+
+const ElementMap &vert_to_edge_map(const Mesh &mesh)
+{
+  return get_cache(mesh).vert_to_edge.ensure([&](ElementMap &r_map) {
+    const Span<MEdge> edges{mesh.medge, mesh.totedge};
+    build_element_map(
+        mesh.totvert,
+        [&](const auto &fn) {
+          for (const int edge_index : edges.index_range()) {
+            fn(edges[edge_index].v1, edge_index);
+            fn(edges[edge_index].v2, edge_index);
+          }
+        },
+        r_map);
+  });
+}
+
+const ElementMap &vert_to_poly_map(const Mesh &mesh)
+{
+  return get_cache(mesh).vert_to_poly.ensure([&](ElementMap &r_map) {
+    const Span<MPoly> polys{mesh.mpoly, mesh.totpoly};
+    const Span<MLoop> loops{mesh.mloop, mesh.totloop};
+    build_element_map(
+        mesh.totvert,
+        [&](const auto &fn) {
+          for (const int poly_index : polys.index_range()) {
+            const MPoly &poly = polys[poly_index];
+            for (const MLoop &loop : loops.slice(poly.loopstart, poly.totloop)) {
+              fn(loop.v, poly_index);
+            }
+          }
+        },
+        r_map);
+  });
+}
+
+const ElementMap &edge_to_poly_map(const Mesh &mesh)
+{
+  return get_cache(mesh).edge_to_poly.ensure([&](ElementMap &r_map) {
+    const Span<MPoly> polys{mesh.mpoly, mesh.totpoly};
+    const Span<MLoop> loops{mesh.mloop, mesh.totloop};
+    build_element_map(
+        mesh.totedge,
+        [&](const auto &fn) {
+          for (const int poly_index : polys.index_range()) {
+            const MPoly &poly = polys[poly_index];
+            for (const MLoop &loop : loops.slice(poly.loopstart, poly.totloop)) {
+              fn(loop.e, poly_index);
+            }
+          }
+        },
+        r_map);
+  });
+}
+
+static const VertIslands &ensure_vert_islands(const Mesh &mesh)
+{
+  return get_cache(mesh).vert_islands.ensure([&](VertIslands &r_islands) {
+    DisjointSet islands(mesh.totvert);
+    for (const MEdge &edge : Span<MEdge>(mesh.medge, mesh.totedge)) {
+      islands.join(edge.v1, edge.v2);
+    }
+
+    r_islands.indices.reinitialize(mesh.totvert);
+    VectorSet<int64_t> ordered_roots;
+    for (const int i : IndexRange(mesh.totvert)) {
+      const int64_t root = islands.find_root(i);
+      r_islands.indices[i] = ordered_roots.index_of_or_add(root);
+    }
+    r_islands.islands_num = ordered_roots.size();
+  });
+}
+
+Span<int> vert_islands(const Mesh &mesh)
+{
+  return ensure_vert_islands(mesh).indices;
+}
+
+int islands_num(const Mesh &mesh)
+{
+  return ensure_vert_islands(mesh).islands_num;
+}
+
+}  // namespace blender::bke::mesh_topology
+
+/* -------------------------------------------------------------------- */
+/** \name C API
+ * \{ */
+
+MeshTopologyCache *BKE_mesh_topology_cache_create()
+{
+  return MEM_new<MeshTopologyCache>(__func__);
+}
+
+void BKE_mesh_topology_cache_free(MeshTopologyCache *cache)
+{
+  MEM_delete(cache);
+}
+
+void BKE_mesh_topology_cache_clear(MeshTopologyCache *cache)
+{
+  cache->vert_to_edge.clear();
+  cache->vert_to_poly.clear();
+  cache->edge_to_poly.clear();
+  cache->vert_islands.clear();
+}
+
+/** \} */
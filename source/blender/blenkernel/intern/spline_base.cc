@@ -214,9 +214,11 @@ static float3 direction_bisect(const float3 &prev, const float3 &middle, const f
   return result;
 }
 
-static void calculate_tangents(Span<float3> positions,
-                               const bool is_cyclic,
-                               MutableSpan<float3> tangents)
+namespace blender::bke::curves::poly {
+
+void calculate_tangents(const Span<float3> positions,
+                        const bool is_cyclic,
+                        MutableSpan<float3> tangents)
 {
   using namespace blender::math;
 
@@ -243,6 +245,32 @@ static void calculate_tangents(Span<float3> positions,
   }
 }
 
+void calculate_tangents(const Span<int> curve_offsets,
+                        const Span<bool> cyclic,
+                        const Span<float3> positions,
+                        MutableSpan<float3> tangents)
+{
+  const int curves_num = cyclic.size();
+  BLI_assert(curve_offsets.size() == curves_num + 1);
+  if (curves_num == 0) {
+    return;
+  }
+
+  const int average_size = std::max<int>(positions.size() / curves_num, 1);
+  const int grain_size = std::max(1024 / average_size, 1);
+  threading::parallel_for(IndexRange(curves_num), grain_size, [&](const IndexRange range) {
+    for (const int i_curve : range) {
+      const IndexRange points(curve_offsets[i_curve],
+                              curve_offsets[i_curve + 1] - curve_offsets[i_curve]);
+      if (points.size() > 0) {
+        calculate_tangents(positions.slice(points), cyclic[i_curve], tangents.slice(points));
+      }
+    }
+  });
+}
+
+}  // namespace blender::bke::curves::poly
+
 Span<float3> Spline::evaluated_tangents() const
 {
   if (!tangent_cache_dirty_) {
@@ -259,7 +287,8 @@ Span<float3> Spline::evaluated_tangents() const
 
   Span<float3> positions = this->evaluated_positions();
 
-  calculate_tangents(positions, is_cyclic_, evaluated_tangents_cache_);
+  blender::bke::curves::poly::calculate_tangents(
+      positions, is_cyclic_, evaluated_tangents_cache_);
   this->correct_end_tangents();
 
   tangent_cache_dirty_ = false;
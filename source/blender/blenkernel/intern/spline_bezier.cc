@@ -395,11 +395,13 @@ BezierSpline::InsertResult BezierSpline::calculate_segment_insertion(const int i
   return result;
 }
 
-static void bezier_forward_difference_3d(const float3 &point_0,
-                                         const float3 &point_1,
-                                         const float3 &point_2,
-                                         const float3 &point_3,
-                                         MutableSpan<float3> result)
+namespace blender::bke::curves::bezier {
+
+void evaluate_segment(const float3 &point_0,
+                      const float3 &point_1,
+                      const float3 &point_2,
+                      const float3 &point_3,
+                      MutableSpan<float3> result)
 {
   BLI_assert(result.size() > 0);
   const float inv_len = 1.0f / static_cast<float>(result.size());
@@ -422,6 +424,152 @@ static void bezier_forward_difference_3d(const float3 &point_0,
   }
 }
 
+static void evaluate_segment_or_copy(const float3 &point_0,
+                                     const float3 &point_1,
+                                     const float3 &point_2,
+                                     const float3 &point_3,
+                                     MutableSpan<float3> result)
+{
+  if (result.size() == 1) {
+    /* Vector segments and segments with a resolution of one only contain the start point. */
+    result.first() = point_0;
+  }
+  else {
+    evaluate_segment(point_0, point_1, point_2, point_3, result);
+  }
+}
+
+/**
+ * Evaluate the given segments of a curve, excluding the segment from the last to the first
+ * control point. The evaluated offsets may start at any index, they are relative to the first.
+ */
+static void evaluate_segments(const Span<float3> positions,
+                              const Span<float3> handles_left,
+                              const Span<float3> handles_right,
+                              const Span<int> evaluated_offsets,
+                              const IndexRange segments,
+                              MutableSpan<float3> evaluated_positions)
+{
+  const int offset = evaluated_offsets.first();
+  for (const int i : segments) {
+    const IndexRange evaluated_range(evaluated_offsets[i] - offset,
+                                     evaluated_offsets[i + 1] - evaluated_offsets[i]);
+    evaluate_segment_or_copy(positions[i],
+                             handles_right[i],
+                             handles_left[i + 1],
+                             positions[i + 1],
+                             evaluated_positions.slice(evaluated_range));
+  }
+}
+
+static void evaluate_last_segment(const Span<float3> positions,
+                                  const Span<float3> handles_left,
+                                  const Span<float3> handles_right,
+                                  const Span<int> evaluated_offsets,
+                                  const bool cyclic,
+                                  MutableSpan<float3> evaluated_positions)
+{
+  if (cyclic) {
+    const int size = positions.size();
+    const IndexRange evaluated_range(evaluated_offsets[size - 1] - evaluated_offsets.first(),
+                                     evaluated_offsets[size] - evaluated_offsets[size - 1]);
+    evaluate_segment_or_copy(positions.last(),
+                             handles_right.last(),
+                             handles_left.first(),
+                             positions.first(),
+                             evaluated_positions.slice(evaluated_range));
+  }
+  else {
+    /* Since evaluating the bezier segment doesn't add the final point,
+     * it must be added manually in the non-cyclic case. */
+    evaluated_positions.last() = positions.last();
+  }
+}
+
+void calculate_evaluated_positions(const Span<float3> positions,
+                                   const Span<float3> handles_left,
+                                   const Span<float3> handles_right,
+                                   const Span<int> evaluated_offsets,
+                                   const bool cyclic,
+                                   MutableSpan<float3> evaluated_positions)
+{
+  const int size = positions.size();
+  BLI_assert(evaluated_offsets.size() == size + 1);
+  BLI_assert(evaluated_offsets.last() - evaluated_offsets.first() == evaluated_positions.size());
+  if (size == 1) {
+    evaluated_positions.first() = positions.first();
+    return;
+  }
+
+  /* The grain size is based on the average number of evaluated points per segment, so that
+   * short curves are evaluated on the calling thread without any task overhead. */
+  const int average_resolution = std::max<int>(evaluated_positions.size() / size, 1);
+  const int grain_size = std::max(512 / average_resolution, 1);
+  threading::parallel_for(IndexRange(size - 1), grain_size, [&](const IndexRange range) {
+    evaluate_segments(
+        positions, handles_left, handles_right, evaluated_offsets, range, evaluated_positions);
+  });
+
+  evaluate_last_segment(
+      positions, handles_left, handles_right, evaluated_offsets, cyclic, evaluated_positions);
+}
+
+void calculate_evaluated_positions(const Span<int> curve_offsets,
+                                   const Span<bool> cyclic,
+                                   const Span<float3> positions,
+                                   const Span<float3> handles_left,
+                                   const Span<float3> handles_right,
+                                   const Span<int> evaluated_offsets,
+                                   MutableSpan<float3> evaluated_positions)
+{
+  const int curves_num = cyclic.size();
+  BLI_assert(curve_offsets.size() == curves_num + 1);
+  BLI_assert(evaluated_offsets.size() == positions.size() + 1);
+  if (curves_num == 0) {
+    return;
+  }
+
+  /* Every curve is evaluated on a single thread, parallelism comes from evaluating many curves
+   * at the same time. */
+  const int average_evaluated_size = std::max<int>(evaluated_positions.size() / curves_num, 1);
+  const int grain_size = std::max(512 / average_evaluated_size, 1);
+  threading::parallel_for(IndexRange(curves_num), grain_size, [&](const IndexRange range) {
+    for (const int i_curve : range) {
+      const IndexRange points(curve_offsets[i_curve],
+                              curve_offsets[i_curve + 1] - curve_offsets[i_curve]);
+      if (points.size() == 0) {
+        continue;
+      }
+      const Span<float3> curve_positions = positions.slice(points);
+      const Span<float3> curve_handles_left = handles_left.slice(points);
+      const Span<float3> curve_handles_right = handles_right.slice(points);
+      const Span<int> curve_evaluated_offsets = evaluated_offsets.slice(points.start(),
+                                                                        points.size() + 1);
+      MutableSpan<float3> curve_evaluated_positions = evaluated_positions.slice(
+          curve_evaluated_offsets.first(),
+          curve_evaluated_offsets.last() - curve_evaluated_offsets.first());
+      if (points.size() == 1) {
+        curve_evaluated_positions.first() = curve_positions.first();
+        continue;
+      }
+      evaluate_segments(curve_positions,
+                        curve_handles_left,
+                        curve_handles_right,
+                        curve_evaluated_offsets,
+                        IndexRange(points.size() - 1),
+                        curve_evaluated_positions);
+      evaluate_last_segment(curve_positions,
+                            curve_handles_left,
+                            curve_handles_right,
+                            curve_evaluated_offsets,
+                            cyclic[i_curve],
+                            curve_evaluated_positions);
+    }
+  });
+}
+
+}  // namespace blender::bke::curves::bezier
+
 void BezierSpline::evaluate_segment(const int index,
                                     const int next_index,
                                     MutableSpan<float3> positions) const
@@ -431,11 +579,11 @@ void BezierSpline::evaluate_segment(const int index,
     positions.first() = positions_[index];
   }
   else {
-    bezier_forward_difference_3d(positions_[index],
-                                 handle_positions_right_[index],
-                                 handle_positions_left_[next_index],
-                                 positions_[next_index],
-                                 positions);
+    blender::bke::curves::bezier::evaluate_segment(positions_[index],
+                                                   handle_positions_right_[index],
+                                                   handle_positions_left_[next_index],
+                                                   positions_[next_index],
+                                                   positions);
   }
 }
 
@@ -565,26 +713,15 @@ Span<float3> BezierSpline::evaluated_positions() const
 
   this->ensure_auto_handles();
 
-  Span<int> offsets = this->control_point_offsets();
-
-  const int grain_size = std::max(512 / resolution_, 1);
   blender::threading::isolate_task([&]() {
     /* Isolate the task, since this is function is multi-threaded and holds a lock. */
-    blender::threading::parallel_for(IndexRange(size - 1), grain_size, [&](IndexRange range) {
-      for (const int i : range) {
-        this->evaluate_segment(i, i + 1, positions.slice(offsets[i], offsets[i + 1] - offsets[i]));
-      }
-    });
+    blender::bke::curves::bezier::calculate_evaluated_positions(positions_,
+                                                                handle_positions_left_,
+                                                                handle_positions_right_,
+                                                                this->control_point_offsets(),
+                                                                is_cyclic_,
+                                                                positions);
   });
-  if (is_cyclic_) {
-    this->evaluate_segment(
-        size - 1, 0, positions.slice(offsets[size - 1], offsets[size] - offsets[size - 1]));
-  }
-  else {
-    /* Since evaluating the bezier segment doesn't add the final point,
-     * it must be added manually in the non-cyclic case. */
-    positions.last() = positions_.last();
-  }
 
   position_cache_dirty_ = false;
   return positions;
@@ -0,0 +1,122 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_rand.hh"
+
+#include "BKE_spline.hh"
+
+namespace blender::bke::curves::tests {
+
+/* Curves with different sizes, resolutions and cyclic flags, stored in flat arrays. */
+struct FlatCurves {
+  Array<int> curve_offsets;
+  Array<bool> cyclic;
+  Array<float3> positions;
+  Array<float3> handles_left;
+  Array<float3> handles_right;
+  Array<int> evaluated_offsets;
+
+  FlatCurves(const int curves_num)
+  {
+    RandomNumberGenerator rng(0);
+
+    curve_offsets.reinitialize(curves_num + 1);
+    cyclic.reinitialize(curves_num);
+    int offset = 0;
+    for (const int i : IndexRange(curves_num)) {
+      curve_offsets[i] = offset;
+      offset += 1 + (i % 5);
+      cyclic[i] = (i % 3) == 0;
+    }
+    curve_offsets.last() = offset;
+
+    positions.reinitialize(offset);
+    handles_left.reinitialize(offset);
+    handles_right.reinitialize(offset);
+    for (const int i : positions.index_range()) {
+      positions[i] = rng.get_unit_float3();
+      handles_left[i] = positions[i] + rng.get_unit_float3() * 0.5f;
+      handles_right[i] = positions[i] + rng.get_unit_float3() * 0.5f;
+    }
+
+    /* Give every segment a different resolution, including single point segments. */
+    evaluated_offsets.reinitialize(offset + 1);
+    int evaluated_offset = 0;
+    for (const int i_curve : IndexRange(curves_num)) {
+      const IndexRange points = this->points(i_curve);
+      for (const int i : points) {
+        evaluated_offsets[i] = evaluated_offset;
+        const bool is_last = i == points.last();
+        const bool is_single_point = is_last && (!cyclic[i_curve] || points.size() == 1);
+        evaluated_offset += is_single_point ? 1 : 1 + (i % 7);
+      }
+    }
+    evaluated_offsets.last() = evaluated_offset;
+  }
+
+  IndexRange points(const int i_curve) const
+  {
+    return IndexRange(curve_offsets[i_curve], curve_offsets[i_curve + 1] - curve_offsets[i_curve]);
+  }
+
+  IndexRange evaluated_points(const int i_curve) const
+  {
+    const IndexRange points = this->points(i_curve);
+    return IndexRange(evaluated_offsets[points.first()],
+                      evaluated_offsets[points.one_after_last()] -
+                          evaluated_offsets[points.first()]);
+  }
+};
+
+TEST(curves_bezier, batch_matches_single_curve_evaluation)
+{
+  const FlatCurves curves(1000);
+  Array<float3> evaluated_positions(curves.evaluated_offsets.last());
+  bezier::calculate_evaluated_positions(curves.curve_offsets,
+                                        curves.cyclic,
+                                        curves.positions,
+                                        curves.handles_left,
+                                        curves.handles_right,
+                                        curves.evaluated_offsets,
+                                        evaluated_positions);
+
+  for (const int i_curve : curves.cyclic.index_range()) {
+    const IndexRange points = curves.points(i_curve);
+    const IndexRange evaluated_points = curves.evaluated_points(i_curve);
+    Array<int> offsets(points.size() + 1);
+    for (const int i : offsets.index_range()) {
+      offsets[i] = curves.evaluated_offsets[points.first() + i] - evaluated_points.first();
+    }
+    Array<float3> expected(evaluated_points.size());
+    bezier::calculate_evaluated_positions(curves.positions.as_span().slice(points),
+                                          curves.handles_left.as_span().slice(points),
+                                          curves.handles_right.as_span().slice(points),
+                                          offsets,
+                                          curves.cyclic[i_curve],
+                                          expected);
+    for (const int i : expected.index_range()) {
+      EXPECT_EQ(evaluated_positions[evaluated_points[i]], expected[i]);
+    }
+  }
+}
+
+TEST(curves_poly, batch_matches_single_curve_tangents)
+{
+  const FlatCurves curves(1000);
+  Array<float3> tangents(curves.positions.size());
+  poly::calculate_tangents(curves.curve_offsets, curves.cyclic, curves.positions, tangents);
+
+  for (const int i_curve : curves.cyclic.index_range()) {
+    const IndexRange points = curves.points(i_curve);
+    Array<float3> expected(points.size());
+    poly::calculate_tangents(
+        curves.positions.as_span().slice(points), curves.cyclic[i_curve], expected);
+    for (const int i : expected.index_range()) {
+      EXPECT_EQ(tangents[points[i]], expected[i]);
+    }
+  }
+}
+
+}  // namespace blender::bke::curves::tests
@@ -27,6 +27,9 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_hash.h"
+#include "BLI_math_base.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_modifier.h"
@@ -50,6 +53,7 @@ void BKE_subdiv_init()
 
 void BKE_subdiv_exit()
 {
+  BKE_subdiv_cache_clear();
   openSubdiv_cleanup();
 }
 
@@ -210,6 +214,147 @@ void BKE_subdiv_free(Subdiv *subdiv)
   MEM_freeN(subdiv);
 }
 
+/* ============================== SHARED CACHE ============================== */
+
+/* Only a few descriptors are kept, the cache is meant to avoid re-creating the topology refiner
+ * for every evaluation of the same deforming meshes, not to store all descriptors ever used. */
+#define SUBDIV_CACHE_SIZE 8
+/* Upper bound for the total estimated size of the cached descriptors, in refined faces, so that a
+ * few dense meshes don't keep a lot of memory alive. */
+#define SUBDIV_CACHE_MAX_REFINED_FACES (1 << 24)
+/* Number of faces and corners included in the topology hash. */
+#define SUBDIV_TOPOLOGY_HASH_SAMPLES 64
+
+typedef struct SubdivCacheEntry {
+  Subdiv *subdiv;
+  /* Used to find the least recently used entry. */
+  uint64_t last_used;
+} SubdivCacheEntry;
+
+static struct {
+  ThreadMutex mutex;
+  SubdivCacheEntry entries[SUBDIV_CACHE_SIZE];
+  uint64_t use_counter;
+  /* Sum of the sizes of all cached descriptors. */
+  uint64_t refined_faces_num;
+} subdiv_cache = {BLI_MUTEX_INITIALIZER};
+
+/* The hash is only used to find a candidate descriptor in the cache, whether the topology actually
+ * matches is checked when updating the descriptor. So only the element counts and a sample of the
+ * faces are hashed, to keep it cheap for large meshes. */
+static uint32_t subdiv_topology_hash(const SubdivSettings *settings, const Mesh *mesh)
+{
+  uint32_t hash = BLI_hash_int_2d((uint)mesh->totvert, (uint)mesh->totedge);
+  hash = BLI_hash_int_2d(hash, (uint)mesh->totpoly);
+  hash = BLI_hash_int_2d(hash, (uint)mesh->totloop);
+  hash = BLI_hash_int_2d(hash, (uint)settings->level);
+  hash = BLI_hash_int_2d(hash, (uint)settings->is_simple);
+  hash = BLI_hash_int_2d(hash, (uint)settings->use_creases);
+  const int poly_step = max_ii(mesh->totpoly / SUBDIV_TOPOLOGY_HASH_SAMPLES, 1);
+  for (int i = 0; i < mesh->totpoly; i += poly_step) {
+    const MPoly *mpoly = &mesh->mpoly[i];
+    hash = BLI_hash_int_2d(hash, (uint)mpoly->totloop);
+    hash = BLI_hash_int_2d(hash, mesh->mloop[mpoly->loopstart].v);
+  }
+  return hash;
+}
+
+/* Estimate of the memory used by a descriptor, as the number of faces after refinement. */
+static uint64_t subdiv_refined_faces_num(const SubdivSettings *settings, const Mesh *mesh)
+{
+  /* Every corner of a coarse face becomes a quad at the first level, which are split into four
+   * quads at every next level. */
+  const int level = max_ii(settings->level, 1);
+  return (uint64_t)mesh->totloop << (2 * (level - 1));
+}
+
+Subdiv *BKE_subdiv_cache_acquire(const SubdivSettings *settings, const Mesh *mesh)
+{
+  const uint32_t topology_hash = subdiv_topology_hash(settings, mesh);
+
+  Subdiv *cached_subdiv = NULL;
+  BLI_mutex_lock(&subdiv_cache.mutex);
+  for (int i = 0; i < SUBDIV_CACHE_SIZE; i++) {
+    SubdivCacheEntry *entry = &subdiv_cache.entries[i];
+    if (entry->subdiv != NULL && entry->subdiv->cache_.topology_hash == topology_hash &&
+        BKE_subdiv_settings_equal(&entry->subdiv->settings, settings)) {
+      /* Take the descriptor out of the cache, so that no other thread uses it at the same time. */
+      cached_subdiv = entry->subdiv;
+      subdiv_cache.refined_faces_num -= cached_subdiv->cache_.refined_faces_num;
+      entry->subdiv = NULL;
+      break;
+    }
+  }
+  BLI_mutex_unlock(&subdiv_cache.mutex);
+
+  /* This only creates a new topology refiner when the topology actually changed. */
+  Subdiv *subdiv = BKE_subdiv_update_from_mesh(cached_subdiv, settings, mesh);
+  if (subdiv != NULL) {
+    subdiv->cache_.topology_hash = topology_hash;
+    subdiv->cache_.refined_faces_num = subdiv_refined_faces_num(settings, mesh);
+  }
+  return subdiv;
+}
+
+void BKE_subdiv_cache_release(Subdiv *subdiv)
+{
+  const uint64_t refined_faces_num = subdiv->cache_.refined_faces_num;
+  if (refined_faces_num > SUBDIV_CACHE_MAX_REFINED_FACES) {
+    BKE_subdiv_free(subdiv);
+    return;
+  }
+
+  Subdiv *subdivs_to_free[SUBDIV_CACHE_SIZE];
+  int subdivs_to_free_num = 0;
+  BLI_mutex_lock(&subdiv_cache.mutex);
+  /* Evict the least recently used descriptors until there is a free entry and the new descriptor
+   * fits in the size limit. */
+  while (true) {
+    SubdivCacheEntry *least_recently_used = NULL;
+    SubdivCacheEntry *free_entry = NULL;
+    for (int i = 0; i < SUBDIV_CACHE_SIZE; i++) {
+      SubdivCacheEntry *entry = &subdiv_cache.entries[i];
+      if (entry->subdiv == NULL) {
+        free_entry = entry;
+      }
+      else if (least_recently_used == NULL ||
+               entry->last_used < least_recently_used->last_used) {
+        least_recently_used = entry;
+      }
+    }
+    if (free_entry != NULL && subdiv_cache.refined_faces_num + refined_faces_num <=
+                                  SUBDIV_CACHE_MAX_REFINED_FACES) {
+      free_entry->subdiv = subdiv;
+      free_entry->last_used = ++subdiv_cache.use_counter;
+      subdiv_cache.refined_faces_num += refined_faces_num;
+      break;
+    }
+    Subdiv *evicted_subdiv = least_recently_used->subdiv;
+    subdiv_cache.refined_faces_num -= evicted_subdiv->cache_.refined_faces_num;
+    least_recently_used->subdiv = NULL;
+    subdivs_to_free[subdivs_to_free_num++] = evicted_subdiv;
+  }
+  BLI_mutex_unlock(&subdiv_cache.mutex);
+
+  for (int i = 0; i < subdivs_to_free_num; i++) {
+    BKE_subdiv_free(subdivs_to_free[i]);
+  }
+}
+
+void BKE_subdiv_cache_clear(void)
+{
+  BLI_mutex_lock(&subdiv_cache.mutex);
+  for (int i = 0; i < SUBDIV_CACHE_SIZE; i++) {
+    SubdivCacheEntry *entry = &subdiv_cache.entries[i];
+    if (entry->subdiv != NULL) {
+      BKE_subdiv_free(entry->subdiv);
+      entry->subdiv = NULL;
+    }
+  }
+  subdiv_cache.refined_faces_num = 0;
+  BLI_mutex_unlock(&subdiv_cache.mutex);
+}
+
 /* =========================== PTEX FACES AND GRIDS ========================= */
 
 int *BKE_subdiv_face_ptex_offset_get(Subdiv *subdiv)
@@ -68,6 +68,26 @@ void DEG_debug_stats_gnuplot(const struct Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Tracing */
+
+/**
+ * Start recording the evaluation of every operation of all dependency graphs, with timing,
+ * thread and ID information. Restarts the recording when it is already active.
+ *
+ * \param max_events: Number of the newest events which are kept, older events are overwritten.
+ * Zero uses a default of about a million events.
+ */
+void DEG_debug_trace_begin(int max_events);
+/**
+ * Stop recording and write the events in the Chrome trace event format (JSON), which can be
+ * viewed in `chrome://tracing` or Perfetto. Nothing is written when the file path is NULL.
+ * Can be called while dependency graphs are evaluated, it waits for events being recorded.
+ *
+ * \return False when recording was not active or the file could not be written.
+ */
+bool DEG_debug_trace_end(const char *filepath);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
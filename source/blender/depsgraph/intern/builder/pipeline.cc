@@ -47,12 +47,25 @@ void AbstractBuilderPipeline::build()
     start_time = PIL_check_seconds_timer();
   }
 
+  /* Per-step timing is only gathered when time statistics are requested. */
+  const bool do_step_time = (G.debug & G_DEBUG_DEPSGRAPH_TIME) != 0;
+
   build_step_sanity_check();
   build_step_nodes();
+  const double nodes_time = do_step_time ? PIL_check_seconds_timer() : 0.0;
   build_step_relations();
+  const double relations_time = do_step_time ? PIL_check_seconds_timer() : 0.0;
   build_step_finalize();
 
-  if (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) {
+  if (do_step_time) {
+    const double end_time = PIL_check_seconds_timer();
+    printf("Depsgraph built in %f seconds (nodes %f, relations %f, finalize %f).\n",
+           end_time - start_time,
+           nodes_time - start_time,
+           relations_time - nodes_time,
+           end_time - relations_time);
+  }
+  else if (G.debug & G_DEBUG_DEPSGRAPH_BUILD) {
     printf("Depsgraph built in %f seconds.\n", PIL_check_seconds_timer() - start_time);
   }
 }
@@ -107,6 +120,7 @@ void AbstractBuilderPipeline::build_step_finalize()
 #endif
   /* Relations are up to date. */
   deg_graph_->need_update = false;
+  deg_graph_->evaluations_until_cost_sample = 0;
 }
 
 unique_ptr<DepsgraphNodeBuilder> AbstractBuilderPipeline::construct_node_builder()
@@ -0,0 +1,337 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_debug_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "MEM_guardedalloc.h"
+
+#include "PIL_time.h"
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_math_base.h"
+#include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_vector.hh"
+
+#include "DNA_ID.h"
+
+#include "DEG_depsgraph_debug.h"
+
+#include "intern/node/deg_node_component.h"
+#include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
+
+namespace blender::deg {
+
+/* Events are stored in a ring buffer which keeps the newest events. It is allocated in chunks when
+ * they are first needed, so that a short trace takes little memory. */
+static const int64_t TRACE_CHUNK_SIZE = 1 << 12;
+static const int64_t TRACE_DEFAULT_EVENTS_CAPACITY = 1 << 20;
+
+struct TraceEvent {
+  /* Copied, since the operation node can be freed before the trace is written. */
+  char id_name[MAX_ID_NAME];
+  NodeType component_type;
+  OperationCode opcode;
+  int thread_index;
+  double begin_time;
+  double end_time;
+  /* Sequence number of the event stored in the slot: zero when the slot is empty, `2 * (n + 1)`
+   * once event `n` is written and `2 * (n + 1) + 1` while it is being written. A slot is only
+   * claimed for an event newer than the one it contains. */
+  std::atomic<int64_t> state = 0;
+};
+
+struct TraceChunk {
+  TraceEvent events[TRACE_CHUNK_SIZE];
+};
+
+struct TraceBuffer {
+  /* Power of two, so that the slot of an event is a simple mask of its sequence number. */
+  int64_t capacity;
+  Array<std::atomic<TraceChunk *>> chunks;
+  std::atomic<int64_t> events_num = 0;
+  /* Events which were not stored because their slot was still being written by an older event. */
+  std::atomic<int64_t> dropped_events_num = 0;
+  double start_time = PIL_check_seconds_timer();
+
+  TraceBuffer(const int64_t events_capacity)
+      : capacity(std::max(power_of_2_max_i(int(std::min<int64_t>(events_capacity, 1 << 30))),
+                          int(TRACE_CHUNK_SIZE))),
+        chunks(capacity / TRACE_CHUNK_SIZE)
+  {
+    for (std::atomic<TraceChunk *> &chunk : chunks) {
+      chunk.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~TraceBuffer()
+  {
+    for (std::atomic<TraceChunk *> &chunk : chunks) {
+      MEM_delete(chunk.load());
+    }
+  }
+
+  TraceEvent &slot(const int64_t sequence)
+  {
+    const int64_t index = sequence & (capacity - 1);
+    const int64_t chunk_index = index / TRACE_CHUNK_SIZE;
+    TraceChunk *chunk = chunks[chunk_index].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      TraceChunk *new_chunk = MEM_new<TraceChunk>(__func__);
+      if (chunks[chunk_index].compare_exchange_strong(
+              chunk, new_chunk, std::memory_order_acq_rel)) {
+        chunk = new_chunk;
+      }
+      else {
+        /* Another thread allocated the chunk first. */
+        MEM_delete(new_chunk);
+      }
+    }
+    return chunk->events[index % TRACE_CHUNK_SIZE];
+  }
+
+  const TraceEvent *find_written_event(const int64_t sequence) const
+  {
+    const int64_t index = sequence & (capacity - 1);
+    const TraceChunk *chunk = chunks[index / TRACE_CHUNK_SIZE].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      return nullptr;
+    }
+    const TraceEvent &event = chunk->events[index % TRACE_CHUNK_SIZE];
+    if (event.state.load(std::memory_order_acquire) != 2 * (sequence + 1)) {
+      /* Dropped, or overwritten by a newer event. */
+      return nullptr;
+    }
+    return &event;
+  }
+};
+
+static std::atomic<TraceBuffer *> active_trace = nullptr;
+
+/**
+ * Trace which a thread is recording into, a trace is only freed once no thread is recording into
+ * it anymore. Every thread only writes its own state, so recording does not contend on a shared
+ * cache line. The states of all threads are registered for #retire_trace.
+ */
+struct alignas(64) TraceThreadState {
+  std::atomic<TraceBuffer *> recording_trace = nullptr;
+
+  TraceThreadState();
+  ~TraceThreadState();
+};
+
+static std::mutex thread_states_mutex;
+static Vector<TraceThreadState *> thread_states;
+
+TraceThreadState::TraceThreadState()
+{
+  std::lock_guard lock{thread_states_mutex};
+  thread_states.append(this);
+}
+
+TraceThreadState::~TraceThreadState()
+{
+  std::lock_guard lock{thread_states_mutex};
+  thread_states.remove_first_occurrence_and_reorder(this);
+}
+
+static TraceThreadState &thread_state()
+{
+  static thread_local TraceThreadState state;
+  return state;
+}
+
+bool deg_debug_trace_is_active()
+{
+  return active_trace.load(std::memory_order_relaxed) != nullptr;
+}
+
+static void trace_record_event(TraceBuffer &trace,
+                               const OperationNode *operation_node,
+                               const double begin_time,
+                               const double end_time)
+{
+  const int64_t sequence = trace.events_num.fetch_add(1, std::memory_order_relaxed);
+  TraceEvent &event = trace.slot(sequence);
+  const int64_t new_state = 2 * (sequence + 1);
+  int64_t state = event.state.load(std::memory_order_relaxed);
+  while (true) {
+    if (state >= new_state) {
+      /* A newer event was stored already, this can only happen when this thread was interrupted
+       * for a whole round of the ring buffer. */
+      return;
+    }
+    if (state & 1) {
+      /* An older event is still being written, keeping this one would require waiting. */
+      trace.dropped_events_num.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    if (event.state.compare_exchange_weak(state, new_state + 1, std::memory_order_acquire)) {
+      break;
+    }
+  }
+
+  const ComponentNode *component_node = operation_node->owner;
+  STRNCPY(event.id_name, component_node->owner->id_orig->name);
+  event.component_type = component_node->type;
+  event.opcode = operation_node->opcode;
+  event.thread_index = BLI_task_parallel_thread_id(nullptr);
+  event.begin_time = begin_time;
+  event.end_time = end_time;
+  event.state.store(new_state, std::memory_order_release);
+}
+
+void deg_debug_trace_record(const OperationNode *operation_node,
+                            const double begin_time,
+                            const double end_time)
+{
+  TraceThreadState &state = thread_state();
+  TraceBuffer *trace = active_trace.load();
+  if (trace == nullptr) {
+    return;
+  }
+  /* Sequentially consistent, so that #retire_trace either sees this thread recording into the
+   * trace or this thread sees that the trace was retired. */
+  state.recording_trace.store(trace);
+  if (active_trace.load() == trace) {
+    trace_record_event(*trace, operation_node, begin_time, end_time);
+  }
+  state.recording_trace.store(nullptr, std::memory_order_release);
+}
+
+/* Stop recording into the active trace, and wait until no thread is writing into it anymore. */
+static TraceBuffer *retire_trace(TraceBuffer *new_trace)
+{
+  TraceBuffer *trace = active_trace.exchange(new_trace);
+  if (trace != nullptr) {
+    std::lock_guard lock{thread_states_mutex};
+    for (const TraceThreadState *state : thread_states) {
+      while (state->recording_trace.load() == trace) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  return trace;
+}
+
+static void write_json_string(FILE *file, const char *str)
+{
+  fputc('"', file);
+  for (const char *c = str; *c; c++) {
+    if (ELEM(*c, '"', '\\')) {
+      fputc('\\', file);
+      fputc(*c, file);
+    }
+    else if ((unsigned char)*c < 0x20) {
+      fprintf(file, "\\u%04x", (unsigned char)*c);
+    }
+    else {
+      fputc(*c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static bool write_trace(const TraceBuffer &trace, const char *filepath)
+{
+  FILE *file = BLI_fopen(filepath, "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  const int64_t events_num = trace.events_num.load();
+  const int64_t first_event = std::max<int64_t>(events_num - trace.capacity, 0);
+  if (first_event > 0) {
+    printf("Depsgraph trace: contains the newest %lld of %lld events.\n",
+           (long long)trace.capacity,
+           (long long)events_num);
+  }
+  if (trace.dropped_events_num.load() > 0) {
+    printf("Depsgraph trace: %lld events were dropped.\n",
+           (long long)trace.dropped_events_num.load());
+  }
+
+  fputs("{\"traceEvents\":[\n", file);
+  bool is_first_event = true;
+  for (int64_t sequence = first_event; sequence < events_num; sequence++) {
+    const TraceEvent *event_ptr = trace.find_written_event(sequence);
+    if (event_ptr == nullptr) {
+      continue;
+    }
+    const TraceEvent &event = *event_ptr;
+    /* Skip the two character ID code, it is implied by the component. */
+    const char *id_name = event.id_name + 2;
+    char name[MAX_ID_NAME + 128];
+    BLI_snprintf(name, sizeof(name), "%s: %s", id_name, operationCodeAsString(event.opcode));
+    fputs(is_first_event ? "{\"name\":" : ",\n{\"name\":", file);
+    is_first_event = false;
+    write_json_string(file, name);
+    fputs(",\"cat\":", file);
+    write_json_string(file, nodeTypeAsString(event.component_type));
+    fprintf(file,
+            ",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"id\":",
+            event.thread_index,
+            (event.begin_time - trace.start_time) * 1e6,
+            (event.end_time - event.begin_time) * 1e6);
+    write_json_string(file, event.id_name);
+    fputs("}}", file);
+  }
+  fputs("\n]}\n", file);
+
+  const bool success = (ferror(file) == 0);
+  fclose(file);
+  return success;
+}
+
+}  // namespace blender::deg
+
+namespace deg = blender::deg;
+
+void DEG_debug_trace_begin(const int max_events)
+{
+  deg::TraceBuffer *old_trace = deg::retire_trace(MEM_new<deg::TraceBuffer>(
+      __func__, max_events > 0 ? max_events : deg::TRACE_DEFAULT_EVENTS_CAPACITY));
+  MEM_delete(old_trace);
+}
+
+bool DEG_debug_trace_end(const char *filepath)
+{
+  deg::TraceBuffer *trace = deg::retire_trace(nullptr);
+  if (trace == nullptr) {
+    return false;
+  }
+  bool success = true;
+  if (filepath != nullptr) {
+    success = deg::write_trace(*trace, filepath);
+    if (!success) {
+      fprintf(stderr, "Depsgraph trace: could not write to file \"%s\".\n", filepath);
+    }
+  }
+  MEM_delete(trace);
+  return success;
+}
@@ -0,0 +1,41 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Recording of operation evaluation events of all dependency graphs, which can be written to a
+ * file in the Chrome trace event format, to be viewed in `chrome://tracing` or Perfetto.
+ */
+
+#pragma once
+
+namespace blender::deg {
+
+struct OperationNode;
+
+/** Whether evaluation events are being recorded, see #DEG_debug_trace_begin. */
+bool deg_debug_trace_is_active();
+
+/**
+ * Record the evaluation of an operation. Can be called from any thread, the events are stored
+ * without locking in a ring buffer of limited size, which keeps the newest events.
+ */
+void deg_debug_trace_record(const OperationNode *operation_node,
+                            double begin_time,
+                            double end_time);
+
+}  // namespace blender::deg
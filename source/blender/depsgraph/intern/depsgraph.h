@@ -162,6 +162,11 @@ struct Depsgraph {
 
   bool is_evaluating;
 
+  /* Number of evaluations left until the cost of operations is sampled again to update their
+   * scheduling priority. Zero after relations are rebuilt, so that new operations get a cost on
+   * the next evaluation. */
+  int evaluations_until_cost_sample;
+
   /* Is set to truth for dependency graph which are used for post-processing (compositor and
    * sequencer).
    * Such dependency graph needs all view layers (so render pipeline can access names), but it
@@ -25,12 +25,17 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+
+#include "MEM_guardedalloc.h"
+
 #include "PIL_time.h"
 
 #include "BLI_compiler_attrs.h"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.h"
 
@@ -47,6 +52,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.h"
 #include "intern/depsgraph_relation.h"
 #include "intern/depsgraph_tag.h"
@@ -65,18 +71,11 @@ namespace {
 
 struct DepsgraphEvalState;
 
-void deg_task_run_func(TaskPool *pool, void *taskdata);
+/* Operations which are ready to be evaluated, collected before they are handed over to the
+ * scheduler so that they can be ordered by their critical path cost. */
+using ReadyOperations = Vector<OperationNode *, 16>;
 
-template<typename ScheduleFunction, typename... ScheduleFunctionArgs>
-void schedule_children(DepsgraphEvalState *state,
-                       OperationNode *node,
-                       ScheduleFunction *schedule_function,
-                       ScheduleFunctionArgs... schedule_function_args);
-
-void schedule_node_to_pool(OperationNode *node, const int UNUSED(thread_id), TaskPool *pool)
-{
-  BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-}
+void schedule_children(DepsgraphEvalState *state, OperationNode *node, ReadyOperations &r_ready);
 
 /* Denotes which part of dependency graph is being evaluated. */
 enum class EvaluationStage {
@@ -98,6 +97,9 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  /* Measure the evaluation time of every operation, either for statistics or to sample the cost
+   * of operations for scheduling. */
+  bool do_timing;
   EvaluationStage stage;
   bool need_single_thread_pass;
 };
@@ -109,27 +111,126 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
-    const double start_time = PIL_check_seconds_timer();
+  if (!state->do_timing && !deg_debug_trace_is_active()) {
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
+    return;
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  const double start_time = PIL_check_seconds_timer();
+  operation_node->evaluate(depsgraph);
+  const double end_time = PIL_check_seconds_timer();
+  operation_node->stats.current_time += end_time - start_time;
+  if (deg_debug_trace_is_active()) {
+    deg_debug_trace_record(operation_node, start_time, end_time);
   }
 }
 
-void deg_task_run_func(TaskPool *pool, void *taskdata)
+/* Order operations so that the ones starting the most expensive chains come first. */
+void sort_by_critical_path(MutableSpan<OperationNode *> operations)
+{
+  std::stable_sort(operations.begin(),
+                   operations.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_cost > b->critical_path_cost;
+                   });
+}
+
+/* Number of evaluations between the ones which sample the cost of operations, to avoid the
+ * overhead of timing every operation and of updating the critical path on every evaluation. */
+const int COST_SAMPLE_INTERVAL = 16;
+
+/* Operations which are expected to take less time than this (in seconds) are scheduled in
+ * batches, since the overhead of a separate task would be larger than the work itself. */
+const float CHEAP_OPERATION_COST = 10e-6f;
+/* Maximum number of operations in a batch, so that other threads still get work to pick up. */
+const int MAX_BATCH_SIZE = 64;
+
+bool is_cheap_operation(const OperationNode *node)
+{
+  /* Operations without a known cost are never batched, to avoid serializing expensive ones. */
+  return node->estimated_cost > 0.0f && node->estimated_cost < CHEAP_OPERATION_COST;
+}
+
+struct OperationBatch {
+  Vector<OperationNode *, MAX_BATCH_SIZE> operations;
+};
+
+void deg_task_run_func(TaskPool *pool, void *taskdata);
+void deg_task_run_batch_func(TaskPool *pool, void *taskdata);
+
+void deg_task_free_batch_func(TaskPool *UNUSED(pool), void *taskdata)
+{
+  MEM_delete(static_cast<OperationBatch *>(taskdata));
+}
+
+void push_batch_to_pool(TaskPool *pool, OperationBatch *batch)
+{
+  BLI_task_pool_push(pool, deg_task_run_batch_func, batch, true, deg_task_free_batch_func);
+}
+
+/* Push operations to the pool in the given order. Cheap operations are grouped into batches,
+ * each of which is evaluated by a single task. */
+void push_operations_to_pool(TaskPool *pool, Span<OperationNode *> operations)
+{
+  OperationBatch *batch = nullptr;
+  for (OperationNode *operation_node : operations) {
+    if (!is_cheap_operation(operation_node)) {
+      BLI_task_pool_push(pool, deg_task_run_func, operation_node, false, nullptr);
+      continue;
+    }
+    if (batch == nullptr) {
+      batch = MEM_new<OperationBatch>(__func__);
+    }
+    batch->operations.append(operation_node);
+    if (batch->operations.size() == MAX_BATCH_SIZE) {
+      push_batch_to_pool(pool, batch);
+      batch = nullptr;
+    }
+  }
+  if (batch != nullptr) {
+    push_batch_to_pool(pool, batch);
+  }
+}
+
+/* Evaluate the given operations, followed by the operations which became ready because of them.
+ * A single operation continues with its highest priority child on this thread, without going
+ * through the pool. A batch pushes all children instead, so that an expensive subtree below one
+ * of its operations does not delay the rest of the batch. */
+void evaluate_operations(TaskPool *pool, Span<OperationNode *> operations, bool is_batch)
 {
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
+  /* All operations of a batch are evaluated before any of their children, so that the children of
+   * one operation do not delay the others. */
+  ReadyOperations ready_operations;
+  for (OperationNode *operation_node : operations) {
+    evaluate_node(state, operation_node);
+    schedule_children(state, operation_node, ready_operations);
+  }
+
+  while (!ready_operations.is_empty()) {
+    OperationNode *operation_node = deg_eval_order_ready_operations(ready_operations, is_batch);
+    if (operation_node == nullptr) {
+      push_operations_to_pool(pool, ready_operations);
+      return;
+    }
+    push_operations_to_pool(pool, ready_operations.as_span().drop_back(1));
+    ready_operations.clear();
+    evaluate_node(state, operation_node);
+    schedule_children(state, operation_node, ready_operations);
+  }
+}
+
+void deg_task_run_func(TaskPool *pool, void *taskdata)
+{
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  evaluate_operations(pool, {&operation_node, 1}, false);
+}
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, schedule_node_to_pool, pool);
+void deg_task_run_batch_func(TaskPool *pool, void *taskdata)
+{
+  const OperationBatch *batch = static_cast<const OperationBatch *>(taskdata);
+  evaluate_operations(pool, batch->operations, true);
 }
 
 bool check_operation_node_visible(OperationNode *op_node)
@@ -182,15 +283,12 @@ void calculate_pending_parents(Depsgraph *graph)
   }
 }
 
-void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
+void initialize_execution(DepsgraphEvalState *UNUSED(state), Depsgraph *graph)
 {
-  const bool do_stats = state->do_stats;
   calculate_pending_parents(graph);
   /* Clear tags and other things which needs to be clear. */
   for (OperationNode *node : graph->operations) {
-    if (do_stats) {
-      node->stats.reset_current();
-    }
+    node->stats.reset_current();
   }
 }
 
@@ -231,16 +329,14 @@ bool need_evaluate_operation_at_stage(DepsgraphEvalState *state,
   return false;
 }
 
-/* Schedule a node if it needs evaluation.
+/* Schedule a node if it needs evaluation, by adding it to the ready operations.
  *   dec_parents: Decrement pending parents count, true when child nodes are
  *                scheduled after a task has been completed.
  */
-template<typename ScheduleFunction, typename... ScheduleFunctionArgs>
 void schedule_node(DepsgraphEvalState *state,
                    OperationNode *node,
                    bool dec_parents,
-                   ScheduleFunction *schedule_function,
-                   ScheduleFunctionArgs... schedule_function_args)
+                   ReadyOperations &r_ready)
 {
   /* No need to schedule nodes of invisible ID. */
   if (!check_operation_node_visible(node)) {
@@ -271,30 +367,31 @@ void schedule_node(DepsgraphEvalState *state,
   if (!is_scheduled) {
     if (node->is_noop()) {
       /* skip NOOP node, schedule children right away */
-      schedule_children(state, node, schedule_function, schedule_function_args...);
+      schedule_children(state, node, r_ready);
     }
     else {
       /* children are scheduled once this task is completed */
-      schedule_function(node, 0, schedule_function_args...);
+      r_ready.append(node);
     }
   }
 }
 
-template<typename ScheduleFunction, typename... ScheduleFunctionArgs>
-void schedule_graph(DepsgraphEvalState *state,
-                    ScheduleFunction *schedule_function,
-                    ScheduleFunctionArgs... schedule_function_args)
+void schedule_graph(DepsgraphEvalState *state, ReadyOperations &r_ready)
 {
   for (OperationNode *node : state->graph->operations) {
-    schedule_node(state, node, false, schedule_function, schedule_function_args...);
+    schedule_node(state, node, false, r_ready);
   }
+  sort_by_critical_path(r_ready);
+}
+
+void schedule_graph_to_pool(DepsgraphEvalState *state, TaskPool *pool)
+{
+  ReadyOperations ready_operations;
+  schedule_graph(state, ready_operations);
+  push_operations_to_pool(pool, ready_operations);
 }
 
-template<typename ScheduleFunction, typename... ScheduleFunctionArgs>
-void schedule_children(DepsgraphEvalState *state,
-                       OperationNode *node,
-                       ScheduleFunction *schedule_function,
-                       ScheduleFunctionArgs... schedule_function_args)
+void schedule_children(DepsgraphEvalState *state, OperationNode *node, ReadyOperations &r_ready)
 {
   for (Relation *rel : node->outlinks) {
     OperationNode *child = (OperationNode *)rel->to;
@@ -303,32 +400,29 @@ void schedule_children(DepsgraphEvalState *state,
       /* Happens when having cyclic dependencies. */
       continue;
     }
-    schedule_node(state,
-                  child,
-                  (rel->flag & RELATION_FLAG_CYCLIC) == 0,
-                  schedule_function,
-                  schedule_function_args...);
+    schedule_node(state, child, (rel->flag & RELATION_FLAG_CYCLIC) == 0, r_ready);
   }
 }
 
-void schedule_node_to_queue(OperationNode *node,
-                            const int /*thread_id*/,
-                            GSQueue *evaluation_queue)
-{
-  BLI_gsqueue_push(evaluation_queue, &node);
-}
-
 void evaluate_graph_single_threaded(DepsgraphEvalState *state)
 {
   GSQueue *evaluation_queue = BLI_gsqueue_new(sizeof(OperationNode *));
-  schedule_graph(state, schedule_node_to_queue, evaluation_queue);
+  ReadyOperations ready_operations;
+  schedule_graph(state, ready_operations);
 
-  while (!BLI_gsqueue_is_empty(evaluation_queue)) {
+  while (true) {
+    for (OperationNode *node : ready_operations) {
+      BLI_gsqueue_push(evaluation_queue, &node);
+    }
+    if (BLI_gsqueue_is_empty(evaluation_queue)) {
+      break;
+    }
     OperationNode *operation_node;
     BLI_gsqueue_pop(evaluation_queue, &operation_node);
 
     evaluate_node(state, operation_node);
-    schedule_children(state, operation_node, schedule_node_to_queue, evaluation_queue);
+    ready_operations.clear();
+    schedule_children(state, operation_node, ready_operations);
   }
 
   BLI_gsqueue_free(evaluation_queue);
@@ -352,6 +446,20 @@ void depsgraph_ensure_view_layer(Depsgraph *graph)
 
 }  // namespace
 
+OperationNode *deg_eval_order_ready_operations(MutableSpan<OperationNode *> operations,
+                                               const bool is_batch)
+{
+  std::stable_sort(operations.begin(),
+                   operations.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_cost < b->critical_path_cost;
+                   });
+  if (is_batch || operations.is_empty()) {
+    return nullptr;
+  }
+  return operations.last();
+}
+
 static TaskPool *deg_evaluate_task_pool_create(DepsgraphEvalState *state)
 {
   if (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS) {
@@ -381,6 +489,9 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  /* Operation costs only change slowly, so they are only sampled every few evaluations. */
+  const bool do_sample_costs = (graph->evaluations_until_cost_sample == 0);
+  state.do_timing = state.do_stats || do_sample_costs;
   state.need_single_thread_pass = false;
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
@@ -389,14 +500,14 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   /* First, process all Copy-On-Write nodes. */
   state.stage = EvaluationStage::COPY_ON_WRITE;
   TaskPool *task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
   /* After that, process all other nodes. */
   state.stage = EvaluationStage::THREADED_EVALUATION;
   task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
@@ -411,6 +522,14 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
   }
+  /* Prepare scheduling priorities for the next evaluations. */
+  if (do_sample_costs) {
+    deg_eval_stats_update_critical_path(graph);
+    graph->evaluations_until_cost_sample = COST_SAMPLE_INTERVAL;
+  }
+  else {
+    graph->evaluations_until_cost_sample--;
+  }
   /* Clear any uncleared tags - just in case. */
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
@@ -25,10 +25,13 @@
 
 #pragma once
 
+#include "BLI_span.hh"
+
 namespace blender {
 namespace deg {
 
 struct Depsgraph;
+struct OperationNode;
 
 /**
  * Evaluate all nodes tagged for updating,
@@ -39,5 +42,17 @@ struct Depsgraph;
  */
 void deg_evaluate_on_refresh(Depsgraph *graph);
 
+/**
+ * Order the operations which became ready after evaluating a task, in the order in which they are
+ * pushed to the task pool. A thread runs the tasks it pushed itself last-in-first-out, so the
+ * operations are sorted by ascending critical path cost.
+ *
+ * eturn The operation with the highest priority, which is to be evaluated on the current thread
+ * instead of being pushed. It is the last operation of the span. Null when evaluating a batch,
+ * where all operations are pushed to let other threads pick up their subtrees.
+ */
+OperationNode *deg_eval_order_ready_operations(MutableSpan<OperationNode *> operations,
+                                               bool is_batch);
+
 }  // namespace deg
 }  // namespace blender
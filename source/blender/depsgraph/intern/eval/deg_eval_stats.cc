@@ -23,9 +23,13 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "intern/depsgraph.h"
+#include "intern/depsgraph_relation.h"
 
 #include "intern/node/deg_node.h"
 #include "intern/node/deg_node_component.h"
@@ -54,4 +58,96 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+namespace {
+
+/* Weight of the last evaluation when updating the estimated cost of an operation. Averaging
+ * avoids scheduling changes caused by a single slow evaluation. */
+const float COST_UPDATE_FACTOR = 0.25f;
+
+/* Cost added for every operation in a chain, representing the scheduling overhead. This makes
+ * longer chains preferred when no timing is known yet, for example after relations update. */
+const float OPERATION_BASE_COST = 1e-6f;
+
+enum {
+  CRITICAL_PATH_UNVISITED = 0,
+  CRITICAL_PATH_IN_PROGRESS = 1,
+  CRITICAL_PATH_DONE = 2,
+};
+
+void update_estimated_cost(OperationNode *op_node)
+{
+  /* Only operations which were actually evaluated have a meaningful timing. */
+  if (!op_node->scheduled || op_node->is_noop()) {
+    return;
+  }
+  const float time = op_node->stats.current_time;
+  if (op_node->estimated_cost == 0.0f) {
+    op_node->estimated_cost = time;
+  }
+  else {
+    op_node->estimated_cost += (time - op_node->estimated_cost) * COST_UPDATE_FACTOR;
+  }
+}
+
+void finish_critical_path(OperationNode *op_node)
+{
+  float max_child_cost = 0.0f;
+  for (Relation *rel : op_node->outlinks) {
+    if (rel->flag & RELATION_FLAG_CYCLIC) {
+      continue;
+    }
+    const OperationNode *child = (OperationNode *)rel->to;
+    /* Children which are still in progress are part of a dependency cycle which was not marked
+     * as such, ignore them to keep the result finite. */
+    if (child->custom_flags == CRITICAL_PATH_DONE) {
+      max_child_cost = std::max(max_child_cost, child->critical_path_cost);
+    }
+  }
+  op_node->critical_path_cost = op_node->estimated_cost + OPERATION_BASE_COST + max_child_cost;
+  op_node->custom_flags = CRITICAL_PATH_DONE;
+}
+
+}  // namespace
+
+void deg_eval_stats_update_critical_path(Depsgraph *graph)
+{
+  for (OperationNode *op_node : graph->operations) {
+    update_estimated_cost(op_node);
+    op_node->custom_flags = CRITICAL_PATH_UNVISITED;
+  }
+
+  /* Depth-first traversal with an explicit stack, since chains of operations can be too long for
+   * recursion. Every stack entry stores the index of the next relation to visit. */
+  struct StackEntry {
+    OperationNode *op_node;
+    int next_relation;
+  };
+  Vector<StackEntry> stack;
+  for (OperationNode *root : graph->operations) {
+    if (root->custom_flags != CRITICAL_PATH_UNVISITED) {
+      continue;
+    }
+    root->custom_flags = CRITICAL_PATH_IN_PROGRESS;
+    stack.append({root, 0});
+    while (!stack.is_empty()) {
+      StackEntry &entry = stack.last();
+      OperationNode *op_node = entry.op_node;
+      if (entry.next_relation == op_node->outlinks.size()) {
+        finish_critical_path(op_node);
+        stack.remove_last();
+        continue;
+      }
+      const Relation *rel = op_node->outlinks[entry.next_relation++];
+      if (rel->flag & RELATION_FLAG_CYCLIC) {
+        continue;
+      }
+      OperationNode *child = (OperationNode *)rel->to;
+      if (child->custom_flags == CRITICAL_PATH_UNVISITED) {
+        child->custom_flags = CRITICAL_PATH_IN_PROGRESS;
+        stack.append({child, 0});
+      }
+    }
+  }
+}
+
 }  // namespace blender::deg
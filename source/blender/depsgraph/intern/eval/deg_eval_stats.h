@@ -31,5 +31,10 @@ struct Depsgraph;
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Update the estimated cost of operations from their timing in the last evaluation, and
+ * recalculate the critical path cost of all operations. Requires the last evaluation to have
+ * measured the time of every operation. */
+void deg_eval_stats_update_critical_path(Depsgraph *graph);
+
 }  // namespace deg
 }  // namespace blender
@@ -0,0 +1,85 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/eval/deg_eval.h"
+#include "intern/node/deg_node_operation.h"
+
+#include "BLI_vector.hh"
+
+#include "testing/testing.h"
+
+namespace blender::deg::tests {
+
+class DepsgraphReadyOperationsTest : public testing::Test {
+ protected:
+  /* Operations with the critical path costs 2, 0, 3 and 1, in the order they became ready. */
+  OperationNode nodes[4];
+  Vector<OperationNode *> ready;
+
+  void SetUp() override
+  {
+    const float costs[4] = {2.0f, 0.0f, 3.0f, 1.0f};
+    for (int i = 0; i < 4; i++) {
+      nodes[i].critical_path_cost = costs[i];
+      ready.append(&nodes[i]);
+    }
+  }
+};
+
+TEST_F(DepsgraphReadyOperationsTest, continue_with_highest_priority)
+{
+  /* The most expensive chain continues on the current thread. The others are pushed with the
+   * next most expensive one last, which is the first one the thread picks up afterwards. */
+  EXPECT_EQ(deg_eval_order_ready_operations(ready, false), &nodes[2]);
+  EXPECT_EQ(ready[0], &nodes[1]);
+  EXPECT_EQ(ready[1], &nodes[3]);
+  EXPECT_EQ(ready[2], &nodes[0]);
+  EXPECT_EQ(ready[3], &nodes[2]);
+}
+
+TEST_F(DepsgraphReadyOperationsTest, batch_pushes_everything)
+{
+  EXPECT_EQ(deg_eval_order_ready_operations(ready, true), nullptr);
+  EXPECT_EQ(ready[0], &nodes[1]);
+  EXPECT_EQ(ready[1], &nodes[3]);
+  EXPECT_EQ(ready[2], &nodes[0]);
+  EXPECT_EQ(ready[3], &nodes[2]);
+}
+
+TEST_F(DepsgraphReadyOperationsTest, unknown_costs_keep_order)
+{
+  /* Before any cost is sampled, operations are handled in the order they became ready, and the
+   * current thread still continues with one of them. */
+  for (OperationNode &node : nodes) {
+    node.critical_path_cost = 0.0f;
+  }
+  EXPECT_EQ(deg_eval_order_ready_operations(ready, false), &nodes[3]);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(ready[i], &nodes[i]);
+  }
+}
+
+TEST_F(DepsgraphReadyOperationsTest, empty)
+{
+  Vector<OperationNode *> empty;
+  EXPECT_EQ(deg_eval_order_ready_operations(empty, false), nullptr);
+}
+
+}  // namespace blender::deg::tests
@@ -212,7 +212,8 @@ const char *operationCodeAsString(OperationCode opcode)
   return "UNKNOWN";
 }
 
-OperationNode::OperationNode() : name_tag(-1), flag(0)
+OperationNode::OperationNode()
+    : estimated_cost(0.0f), critical_path_cost(0.0f), name_tag(-1), flag(0)
 {
 }
 
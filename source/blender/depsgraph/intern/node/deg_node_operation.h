@@ -272,6 +272,12 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Estimated evaluation time in seconds, averaged over the previous evaluations. */
+  float estimated_cost;
+  /* Estimated time of the longest chain of operations starting with this one. Used to start
+   * operations on the critical path as early as possible during threaded evaluation. */
+  float critical_path_cost;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
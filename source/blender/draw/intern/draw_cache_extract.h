@@ -22,6 +22,7 @@
 
 #pragma once
 
+struct BMesh;
 struct DRWSubdivCache;
 struct TaskGraph;
 
@@ -269,6 +270,17 @@ typedef struct MeshBufferCache {
   } poly_sorted;
 } MeshBufferCache;
 
+/**
+ * Vertex positions and normals the position VBO of an edit-mesh was extracted with.
+ * Used to find the vertices that moved when only updating the VBO in place,
+ * see #BMEditMesh.is_deform_update.
+ */
+typedef struct MeshDeformCache {
+  float (*vert_co)[3];
+  GPUPackedNormal *vert_nor;
+  int vert_len;
+} MeshDeformCache;
+
 #define FOREACH_MESH_BUFFER_CACHE(batch_cache, mbc) \
   for (MeshBufferCache *mbc = &batch_cache->final; \
        mbc == &batch_cache->final || mbc == &batch_cache->cage || mbc == &batch_cache->uv_cage; \
@@ -288,9 +300,17 @@ typedef struct MeshBatchCache {
 
   struct DRWSubdivCache *subdiv_cache;
 
+  MeshDeformCache *deform_cache;
+
   DRWBatchFlag batch_requested; /* DRWBatchFlag */
   DRWBatchFlag batch_ready;     /* DRWBatchFlag */
 
+  /* Task graph generation the last extraction of this cache was pushed to, zero when there is
+   * none. Extraction of different meshes overlaps in the shared draw manager task graph, a cache
+   * that is requested again while its previous extraction may still be running has to wait for
+   * it first. See #DRW_mesh_extraction_task_graph_free. */
+  uint extraction_task_graph_generation;
+
   /* settings to determine if cache is invalid */
   int edge_len;
   int tri_len;
@@ -298,8 +318,12 @@ typedef struct MeshBatchCache {
   int vert_len;
   int mat_len;
   bool is_dirty; /* Instantly invalidates cache, skipping mesh check */
+  /* Only vertices moved since the last update, the position VBO is updated in place. */
+  bool is_deform_dirty;
   bool is_editmode;
   bool is_uvsyncsel;
+  /* The UV VBO stores half floats, see #SCE_PERF_COMPRESSED_UVS. */
+  bool is_uv_compressed;
 
   struct DRW_MeshWeightState weight_state;
 
@@ -340,6 +364,27 @@ void mesh_buffer_cache_create_requested(struct TaskGraph *task_graph,
                                         const struct ToolSettings *ts,
                                         bool use_hide);
 
+/**
+ * Remember the current vertex positions and normals of `bm` for #extract_pos_nor_update_deform.
+ */
+void mesh_deform_cache_update(MeshDeformCache **deform_cache, struct BMesh *bm);
+void mesh_deform_cache_free(MeshDeformCache **deform_cache);
+
+/**
+ * Check if the position VBO of `mbc` can be updated in place for the vertices that moved since
+ * `deform_cache` was updated.
+ */
+bool extract_pos_nor_update_deform_supported(const MeshBufferCache *mbc,
+                                             const MeshDeformCache *deform_cache,
+                                             const struct BMesh *bm);
+/**
+ * Update the positions and normals of the moved vertices in the uploaded position VBO,
+ * only sending the changed ranges of the buffer to the GPU.
+ */
+void extract_pos_nor_update_deform(MeshBufferCache *mbc,
+                                   MeshDeformCache *deform_cache,
+                                   struct BMesh *bm);
+
 void mesh_buffer_cache_create_requested_subdiv(MeshBatchCache *cache,
                                                MeshBufferCache *mbc,
                                                struct DRWSubdivCache *subdiv_cache,
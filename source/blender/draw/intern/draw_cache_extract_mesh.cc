@@ -615,6 +615,7 @@ static void mesh_buffer_cache_create_requested(struct TaskGraph *task_graph,
    */
   const bool do_hq_normals = (scene->r.perf_flag & SCE_PERF_HQ_NORMALS) != 0 ||
                              GPU_use_hq_normals_workaround();
+  const bool do_compressed_uvs = cache->is_uv_compressed;
   const bool override_single_mat = mesh_render_mat_len_get(me) <= 1;
 
   /* Create an array containing all the extractors that needs to be executed. */
@@ -626,7 +627,7 @@ static void mesh_buffer_cache_create_requested(struct TaskGraph *task_graph,
   do { \
     if (DRW_##type##_requested(mbuflist->type.name)) { \
       const MeshExtract *extractor = mesh_extract_override_get( \
-          &extract_##name, do_hq_normals, override_single_mat); \
+          &extract_##name, do_hq_normals, do_compressed_uvs, override_single_mat); \
       extractors.append(extractor); \
     } \
   } while (0)
@@ -384,24 +384,32 @@ void mesh_render_data_update_normals(MeshRenderData *mr, const eMRDataType data_
       mr->poly_normals = BKE_mesh_poly_normals_ensure(mr->me);
     }
     if (((data_flag & MR_DATA_LOOP_NOR) && is_auto_smooth) || (data_flag & MR_DATA_TAN_LOOP_NOR)) {
-      mr->loop_normals = MEM_mallocN(sizeof(*mr->loop_normals) * mr->loop_len, __func__);
-      short(*clnors)[2] = CustomData_get_layer(&mr->me->ldata, CD_CUSTOMLOOPNORMAL);
-      BKE_mesh_normals_loop_split(mr->me->mvert,
-                                  mr->vert_normals,
-                                  mr->vert_len,
-                                  mr->me->medge,
-                                  mr->edge_len,
-                                  mr->me->mloop,
-                                  mr->loop_normals,
-                                  mr->loop_len,
-                                  mr->me->mpoly,
-                                  mr->poly_normals,
-                                  mr->poly_len,
-                                  is_auto_smooth,
-                                  split_angle,
-                                  NULL,
-                                  clnors,
-                                  NULL);
+      if (!BKE_mesh_loop_normals_are_dirty(mr->me)) {
+        /* Usually calculated at the end of the modifier stack already. */
+        mr->loop_normals = CustomData_get_layer(&mr->me->ldata, CD_NORMAL);
+      }
+      else {
+        mr->loop_normals_buffer = MEM_mallocN(sizeof(*mr->loop_normals_buffer) * mr->loop_len,
+                                              __func__);
+        mr->loop_normals = mr->loop_normals_buffer;
+        short(*clnors)[2] = CustomData_get_layer(&mr->me->ldata, CD_CUSTOMLOOPNORMAL);
+        BKE_mesh_normals_loop_split(mr->me->mvert,
+                                    mr->vert_normals,
+                                    mr->vert_len,
+                                    mr->me->medge,
+                                    mr->edge_len,
+                                    mr->me->mloop,
+                                    mr->loop_normals_buffer,
+                                    mr->loop_len,
+                                    mr->me->mpoly,
+                                    mr->poly_normals,
+                                    mr->poly_len,
+                                    is_auto_smooth,
+                                    split_angle,
+                                    NULL,
+                                    clnors,
+                                    NULL);
+      }
     }
   }
   else {
@@ -421,7 +429,9 @@ void mesh_render_data_update_normals(MeshRenderData *mr, const eMRDataType data_
         poly_normals = mr->bm_poly_normals;
       }
 
-      mr->loop_normals = MEM_mallocN(sizeof(*mr->loop_normals) * mr->loop_len, __func__);
+      mr->loop_normals_buffer = MEM_mallocN(sizeof(*mr->loop_normals_buffer) * mr->loop_len,
+                                            __func__);
+      mr->loop_normals = mr->loop_normals_buffer;
       const int clnors_offset = CustomData_get_offset(&mr->bm->ldata, CD_CUSTOMLOOPNORMAL);
       BM_loops_calc_normal_vcos(mr->bm,
                                 vert_coords,
@@ -429,7 +439,7 @@ void mesh_render_data_update_normals(MeshRenderData *mr, const eMRDataType data_
                                 poly_normals,
                                 is_auto_smooth,
                                 split_angle,
-                                mr->loop_normals,
+                                mr->loop_normals_buffer,
                                 NULL,
                                 NULL,
                                 clnors_offset,
@@ -561,7 +571,7 @@ MeshRenderData *mesh_render_data_create(Mesh *me,
 void mesh_render_data_free(MeshRenderData *mr)
 {
   MEM_SAFE_FREE(mr->mlooptri);
-  MEM_SAFE_FREE(mr->loop_normals);
+  MEM_SAFE_FREE(mr->loop_normals_buffer);
 
   /* Loose geometry are owned by #MeshBufferCache. */
   mr->ledges = NULL;
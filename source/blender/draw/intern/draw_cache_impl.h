@@ -230,6 +230,11 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                            const struct Scene *scene,
                                            bool is_paint_mode,
                                            bool use_hide);
+/**
+ * Finish and free a task graph mesh extraction was pushed to. Only one such task graph may exist
+ * at a time.
+ */
+void DRW_mesh_extraction_task_graph_free(struct TaskGraph *task_graph);
 
 struct GPUBatch *DRW_mesh_batch_cache_get_all_verts(struct Mesh *me);
 struct GPUBatch *DRW_mesh_batch_cache_get_all_edges(struct Mesh *me);
@@ -945,6 +945,67 @@ static void mesh_batch_cache_discard_uvedit(MeshBatchCache *cache)
   cache->cd_used.edit_uv = 0;
 }
 
+/* Discard the buffers depending on vertex positions while the topology stays the same.
+ * The position VBO itself is updated in place, see #MeshDeformCache. */
+static void mesh_batch_cache_discard_deform(MeshBatchCache *cache)
+{
+  FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.lnor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_area);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_angle);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.skin_roots);
+    /* The tessellation depends on the shape of the faces. */
+    GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.tris);
+    GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.edituv_tris);
+  }
+  for (int i = 0; i < cache->mat_len; i++) {
+    GPU_INDEXBUF_DISCARD_SAFE(cache->tris_per_mat[i]);
+  }
+  DRWBatchFlag batch_map = BATCH_MAP(vbo.lnor,
+                                     vbo.tan,
+                                     vbo.edge_fac,
+                                     vbo.edituv_stretch_area,
+                                     vbo.edituv_stretch_angle,
+                                     vbo.mesh_analysis,
+                                     vbo.fdots_pos,
+                                     vbo.fdots_nor,
+                                     vbo.skin_roots);
+  batch_map |= BATCH_MAP(ibo.tris, ibo.edituv_tris);
+  mesh_batch_cache_discard_batch(cache, batch_map | SURFACE_PER_MAT_FLAG);
+
+  cache->tot_area = 0.0f;
+  cache->tot_uv_area = 0.0f;
+}
+
+/* Check if only the vertices of the edit-mesh moved and the position VBO can be updated in place
+ * on the next redraw instead of invalidating the whole cache. */
+static bool mesh_batch_cache_use_deform_update(const Mesh *me, const MeshBatchCache *cache)
+{
+  const BMEditMesh *em = me->edit_mesh;
+  if (em == NULL || !em->is_deform_update || !cache->is_editmode || cache->is_dirty) {
+    return false;
+  }
+  /* Only when drawing the edit-mesh itself, modifiers may change the topology. */
+  const Mesh *me_final = em->mesh_eval_final;
+  if (me_final == NULL || me_final != em->mesh_eval_cage ||
+      me_final->runtime.wrapper_type != ME_WRAPPER_TYPE_BMESH) {
+    return false;
+  }
+  if (me_final->runtime.edit_data && me_final->runtime.edit_data->vertexCos) {
+    return false;
+  }
+  if (cache->subdiv_cache != NULL || cache->cage.buff.vbo.pos_nor != NULL ||
+      cache->uv_cage.buff.vbo.pos_nor != NULL) {
+    return false;
+  }
+  return extract_pos_nor_update_deform_supported(&cache->final, cache->deform_cache, em->bm);
+}
+
 static void mesh_batch_cache_discard_uvedit_select(MeshBatchCache *cache)
 {
   FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
@@ -995,7 +1056,13 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *me, eMeshBatchDirtyMode mode)
       mesh_batch_cache_discard_batch(cache, batch_map);
       break;
     case BKE_MESH_BATCH_DIRTY_ALL:
-      cache->is_dirty = true;
+      if (mesh_batch_cache_use_deform_update(me, cache)) {
+        mesh_batch_cache_discard_deform(cache);
+        cache->is_deform_dirty = true;
+      }
+      else {
+        cache->is_dirty = true;
+      }
       break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
@@ -1081,6 +1148,7 @@ static void mesh_batch_cache_clear(Mesh *me)
   drw_mesh_weight_state_clear(&cache->weight_state);
 
   mesh_batch_cache_free_subdiv_cache(cache);
+  mesh_deform_cache_free(&cache->deform_cache);
 }
 
 void DRW_mesh_batch_cache_free(Mesh *me)
@@ -1535,6 +1603,17 @@ static void drw_mesh_batch_cache_check_available(struct TaskGraph *task_graph, M
 }
 #endif
 
+/* Generation of the task graph mesh extraction is pushed to, incremented whenever it is freed.
+ * Caches store it instead of the task graph, which can be reallocated at the same address. */
+static uint extraction_task_graph_generation = 1;
+
+void DRW_mesh_extraction_task_graph_free(struct TaskGraph *task_graph)
+{
+  BLI_task_graph_work_and_wait(task_graph);
+  BLI_task_graph_free(task_graph);
+  extraction_task_graph_generation++;
+}
+
 void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                            Object *ob,
                                            Mesh *me,
@@ -1578,6 +1657,19 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
   /* This could be set for paint mode too, currently it's only used for edit-mode. */
   const bool is_mode_active = is_editmode && DRW_object_is_in_edit_mode(ob);
 
+  /* The buffers of this cache may still be written by an extraction pushed earlier in this
+   * redraw (e.g. when the mesh is shared between objects). Finish it before discarding or
+   * requesting buffers again. */
+  if (cache->extraction_task_graph_generation == extraction_task_graph_generation) {
+    BLI_task_graph_work_and_wait(task_graph);
+  }
+  cache->extraction_task_graph_generation = 0;
+
+  if (cache->is_deform_dirty) {
+    cache->is_deform_dirty = false;
+    extract_pos_nor_update_deform(&cache->final, cache->deform_cache, me->edit_mesh->bm);
+  }
+
   DRWBatchFlag batch_requested = cache->batch_requested;
   cache->batch_requested = 0;
 
@@ -1657,6 +1749,33 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
     drw_mesh_attributes_clear(&cache->attr_needed);
   }
 
+  /* Compressed UVs are only used for shading. Edit-mode and the UV editor draw the UVs as
+   * positions, which need the precision of floats. */
+  const bool use_compressed_uvs = (scene->r.perf_flag & SCE_PERF_COMPRESSED_UVS) &&
+                                  !is_editmode &&
+                                  ((batch_requested | cache->batch_ready) &
+                                   MBC_WIRE_LOOPS_UVS) == 0;
+  if (cache->is_uv_compressed != use_compressed_uvs) {
+    cache->is_uv_compressed = use_compressed_uvs;
+    FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+      GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.uv);
+    }
+    /* The batches may already have been referenced, only clear them. */
+    for (int i = 0; i < cache->mat_len; i++) {
+      GPU_BATCH_CLEAR_SAFE(cache->surface_per_mat[i]);
+    }
+    GPU_BATCH_CLEAR_SAFE(cache->batch.surface);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.wire_loops_uvs);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.edituv_faces_stretch_area);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.edituv_faces_stretch_angle);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.edituv_faces);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.edituv_edges);
+    GPU_BATCH_CLEAR_SAFE(cache->batch.edituv_verts);
+    cache->batch_ready &= ~(MBC_SURFACE | MBC_WIRE_LOOPS_UVS | MBC_EDITUV_FACES_STRETCH_AREA |
+                            MBC_EDITUV_FACES_STRETCH_ANGLE | MBC_EDITUV_FACES | MBC_EDITUV_EDGES |
+                            MBC_EDITUV_VERTS);
+  }
+
   if (batch_requested & MBC_EDITUV) {
     /* Discard UV batches if sync_selection changes */
     const bool is_uvsyncsel = ts && (ts->uv_flag & UV_SYNC_SELECTION);
@@ -2059,6 +2178,17 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                        true);
   }
 
+  if (DRW_vbo_requested(cache->final.buff.vbo.pos_nor)) {
+    /* Remember the extracted positions while transforming, following updates only need to
+     * upload the vertices that moved. */
+    if (is_editmode && me->edit_mesh->is_deform_update && !do_subdivision) {
+      mesh_deform_cache_update(&cache->deform_cache, me->edit_mesh->bm);
+    }
+    else {
+      mesh_deform_cache_free(&cache->deform_cache);
+    }
+  }
+
   if (do_subdivision) {
     DRW_create_subdivision(scene, ob, me, cache, &cache->final, ts);
   }
@@ -2083,14 +2213,21 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                      ts,
                                      use_hide);
 
-  /* Ensure that all requested batches have finished.
-   * Ideally we want to remove this sync, but there are cases where this doesn't work.
-   * See T79038 for example.
-   *
-   * An idea to improve this is to separate the Object mode from the edit mode draw caches. And
-   * based on the mode the correct one will be updated. Other option is to look into using
-   * drw_batch_cache_generate_requested_delayed. */
-  BLI_task_graph_work_and_wait(task_graph);
+  if (is_editmode) {
+    /* Ensure that all requested batches have finished.
+     * Ideally we want to remove this sync, but there are cases where this doesn't work.
+     * See T79038 for example.
+     *
+     * An idea to improve this is to separate the Object mode from the edit mode draw caches. And
+     * based on the mode the correct one will be updated. Other option is to look into using
+     * drw_batch_cache_generate_requested_delayed. */
+    BLI_task_graph_work_and_wait(task_graph);
+  }
+  else {
+    /* Let the extraction of this mesh run in the shared task graph while the next objects are
+     * populated. The draw manager waits for all extractions before drawing. */
+    cache->extraction_task_graph_generation = extraction_task_graph_generation;
+  }
 #ifdef DEBUG
   drw_mesh_batch_cache_check_available(task_graph, me);
 #endif
@@ -179,9 +179,8 @@ static void drw_task_graph_deinit(void)
   BLI_gset_free(DST.delayed_extraction,
                 (void (*)(void *key))drw_batch_cache_generate_requested_evaluated_mesh);
   DST.delayed_extraction = NULL;
-  BLI_task_graph_work_and_wait(DST.task_graph);
 
-  BLI_task_graph_free(DST.task_graph);
+  DRW_mesh_extraction_task_graph_free(DST.task_graph);
   DST.task_graph = NULL;
 }
 
@@ -1708,7 +1707,14 @@ void DRW_draw_render_loop_ex(struct Depsgraph *depsgraph,
     drw_duplidata_free();
     drw_engines_cache_finish();
 
+    /* Waits for the batch-cache extraction of all objects. */
+    PROFILE_START(etime);
     drw_task_graph_deinit();
+#ifdef USE_PROFILE
+    double *extraction_time = DRW_view_data_extraction_time_get(DST.view_data_active);
+    PROFILE_END_UPDATE(*extraction_time, etime);
+#endif
+
     DRW_render_instance_buffer_finish();
 
 #ifdef USE_PROFILE
@@ -2784,8 +2790,7 @@ void DRW_draw_depth_object(
       }
       struct TaskGraph *task_graph = BLI_task_graph_create();
       DRW_mesh_batch_cache_create_requested(task_graph, object, me, scene, false, true);
-      BLI_task_graph_work_and_wait(task_graph);
-      BLI_task_graph_free(task_graph);
+      DRW_mesh_extraction_task_graph_free(task_graph);
 
       const eGPUShaderConfig sh_cfg = use_clipping_planes ? GPU_SHADER_CFG_CLIPPED :
                                                             GPU_SHADER_CFG_DEFAULT;
@@ -297,6 +297,14 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   sprintf(time_to_txt, "%.2fms", *cache_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+  v++;
+
+  u = 0;
+  double *extraction_time = DRW_view_data_extraction_time_get(DST.view_data_active);
+  sprintf(col_label, "Extraction Wait");
+  draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
+  sprintf(time_to_txt, "%.2fms", *extraction_time);
+  draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   v += 2;
 
   /* ------------------------------------------ */
@@ -45,6 +45,7 @@ struct DRWViewData {
   int texture_list_size[2] = {0, 0};
 
   double cache_time = 0.0;
+  double extraction_time = 0.0;
 
   Vector<ViewportEngineData> engines;
   Vector<ViewportEngineData *> enabled_engines;
@@ -154,6 +155,7 @@ static void draw_view_data_clear(DRWViewData *view_data)
 
   view_data->texture_list_size[0] = view_data->texture_list_size[1] = 0;
   view_data->cache_time = 0.0f;
+  view_data->extraction_time = 0.0f;
 }
 
 void DRW_view_data_free(DRWViewData *view_data)
@@ -217,6 +219,11 @@ double *DRW_view_data_cache_time_get(DRWViewData *view_data)
   return &view_data->cache_time;
 }
 
+double *DRW_view_data_extraction_time_get(DRWViewData *view_data)
+{
+  return &view_data->extraction_time;
+}
+
 DefaultFramebufferList *DRW_view_data_default_framebuffer_list_get(DRWViewData *view_data)
 {
   return &view_data->dfbl;
@@ -76,6 +76,14 @@ static const MeshExtract *mesh_extract_override_hq_normals(const MeshExtract *ex
   return extractor;
 }
 
+static const MeshExtract *mesh_extract_override_compressed_uvs(const MeshExtract *extractor)
+{
+  if (extractor == &extract_uv) {
+    return &extract_uv_compressed;
+  }
+  return extractor;
+}
+
 static const MeshExtract *mesh_extract_override_single_material(const MeshExtract *extractor)
 {
   if (extractor == &extract_tris) {
@@ -86,12 +94,17 @@ static const MeshExtract *mesh_extract_override_single_material(const MeshExtrac
 
 const MeshExtract *mesh_extract_override_get(const MeshExtract *extractor,
                                              const bool do_hq_normals,
+                                             const bool do_compressed_uvs,
                                              const bool do_single_mat)
 {
   if (do_hq_normals) {
     extractor = mesh_extract_override_hq_normals(extractor);
   }
 
+  if (do_compressed_uvs) {
+    extractor = mesh_extract_override_compressed_uvs(extractor);
+  }
+
   if (do_single_mat) {
     extractor = mesh_extract_override_single_material(extractor);
   }
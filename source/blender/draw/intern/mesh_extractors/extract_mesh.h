@@ -102,7 +102,9 @@ typedef struct MeshRenderData {
   MLoopTri *mlooptri;
   const float (*vert_normals)[3];
   const float (*poly_normals)[3];
-  float (*loop_normals)[3];
+  const float (*loop_normals)[3];
+  /** Owned storage for #loop_normals, when the mesh doesn't have up to date split normals. */
+  float (*loop_normals_buffer)[3];
   int *lverts, *ledges;
 
   struct {
@@ -316,6 +318,7 @@ void *mesh_extract_buffer_get(const MeshExtract *extractor, MeshBufferList *mbuf
 eMRIterType mesh_extract_iter_type(const MeshExtract *ext);
 const MeshExtract *mesh_extract_override_get(const MeshExtract *extractor,
                                              bool do_hq_normals,
+                                             bool do_compressed_uvs,
                                              bool do_single_mat);
 void mesh_render_data_face_flag(const MeshRenderData *mr,
                                 const BMFace *efa,
@@ -348,6 +351,7 @@ extern const MeshExtract extract_pos_nor_hq;
 extern const MeshExtract extract_lnor_hq;
 extern const MeshExtract extract_lnor;
 extern const MeshExtract extract_uv;
+extern const MeshExtract extract_uv_compressed;
 extern const MeshExtract extract_tan;
 extern const MeshExtract extract_tan_hq;
 extern const MeshExtract extract_sculpt_data;
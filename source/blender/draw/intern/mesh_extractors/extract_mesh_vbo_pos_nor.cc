@@ -23,6 +23,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
 #include "extract_mesh.h"
 
 #include "draw_subdivision.h"
@@ -527,9 +531,217 @@ constexpr MeshExtract create_extractor_pos_nor_hq()
 
 /** \} */
 
+/* ---------------------------------------------------------------------- */
+/** \name Update Position and Vertex Normal of a Deformed Edit-Mesh
+ *
+ * While transforming only the positions and normals of some vertices change.
+ * Instead of extracting the whole VBO again, the vertices that changed are found by comparing
+ * against #MeshDeformCache and only the VBO ranges of the faces using them are uploaded.
+ * \{ */
+
+static bool packed_normal_equal(const GPUPackedNormal a, const GPUPackedNormal b)
+{
+  return (a.x == b.x) && (a.y == b.y) && (a.z == b.z);
+}
+
+static void deform_cache_free(MeshDeformCache **deform_cache_p)
+{
+  MeshDeformCache *deform_cache = *deform_cache_p;
+  if (deform_cache == nullptr) {
+    return;
+  }
+  MEM_freeN(deform_cache->vert_co);
+  MEM_freeN(deform_cache->vert_nor);
+  MEM_freeN(deform_cache);
+  *deform_cache_p = nullptr;
+}
+
+static void deform_cache_update(MeshDeformCache **deform_cache_p, BMesh *bm)
+{
+  if (*deform_cache_p && (*deform_cache_p)->vert_len != bm->totvert) {
+    deform_cache_free(deform_cache_p);
+  }
+  if (*deform_cache_p == nullptr) {
+    MeshDeformCache *deform_cache = MEM_cnew<MeshDeformCache>(__func__);
+    deform_cache->vert_len = bm->totvert;
+    deform_cache->vert_co = static_cast<float(*)[3]>(
+        MEM_malloc_arrayN(bm->totvert, sizeof(*deform_cache->vert_co), __func__));
+    deform_cache->vert_nor = static_cast<GPUPackedNormal *>(
+        MEM_malloc_arrayN(bm->totvert, sizeof(*deform_cache->vert_nor), __func__));
+    *deform_cache_p = deform_cache;
+  }
+
+  MeshDeformCache *deform_cache = *deform_cache_p;
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+  threading::parallel_for(IndexRange(bm->totvert), 4096, [&](const IndexRange range) {
+    for (const int v : range) {
+      const BMVert *eve = BM_vert_at_index(bm, v);
+      copy_v3_v3(deform_cache->vert_co[v], eve->co);
+      deform_cache->vert_nor[v] = GPU_normal_convert_i10_v3(eve->no);
+    }
+  });
+}
+
+static bool pos_nor_update_deform_supported(const MeshBufferCache *mbc,
+                                            const MeshDeformCache *deform_cache,
+                                            const BMesh *bm)
+{
+  if (deform_cache == nullptr || deform_cache->vert_len != bm->totvert) {
+    return false;
+  }
+  const GPUVertBuf *vbo = mbc->buff.vbo.pos_nor;
+  if (vbo == nullptr) {
+    /* Will be extracted when requested. */
+    return true;
+  }
+  const GPUVertBufStatus status = GPU_vertbuf_get_status(vbo);
+  if (!(status & GPU_VERTBUF_DATA_UPLOADED) || (status & GPU_VERTBUF_DATA_DIRTY)) {
+    return false;
+  }
+  /* High quality normals and GPU subdivision use other layouts. */
+  if (GPU_vertbuf_get_format(vbo)->stride != sizeof(PosNorLoop)) {
+    return false;
+  }
+  const int loop_loose_len = mbc->loose_geom.edge_len * 2 + mbc->loose_geom.vert_len;
+  return GPU_vertbuf_get_vertex_len(vbo) == bm->totloop + loop_loose_len;
+}
+
+static void pos_nor_update_deform(MeshBufferCache *mbc,
+                                  MeshDeformCache *deform_cache,
+                                  BMesh *bm)
+{
+  GPUVertBuf *vbo = mbc->buff.vbo.pos_nor;
+  if (vbo == nullptr) {
+    return;
+  }
+
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE | BM_LOOP | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+
+  /* Find the vertices that moved or got a different normal. */
+  Array<bool> vert_changed(bm->totvert);
+  threading::parallel_for(IndexRange(bm->totvert), 4096, [&](const IndexRange range) {
+    for (const int v : range) {
+      const BMVert *eve = BM_vert_at_index(bm, v);
+      const GPUPackedNormal nor = GPU_normal_convert_i10_v3(eve->no);
+      vert_changed[v] = !equals_v3v3(deform_cache->vert_co[v], eve->co) ||
+                        !packed_normal_equal(deform_cache->vert_nor[v], nor);
+      if (vert_changed[v]) {
+        copy_v3_v3(deform_cache->vert_co[v], eve->co);
+        deform_cache->vert_nor[v] = nor;
+      }
+    }
+  });
+
+  Array<bool> face_changed(bm->totface, false);
+  for (const int v : IndexRange(bm->totvert)) {
+    if (vert_changed[v]) {
+      BMIter iter;
+      BMFace *efa;
+      BM_ITER_ELEM (efa, &iter, BM_vert_at_index(bm, v), BM_FACES_OF_VERT) {
+        face_changed[BM_elem_index_get(efa)] = true;
+      }
+    }
+  }
+
+  GPU_vertbuf_use(vbo);
+
+  /* The loops of consecutive faces are stored consecutively, upload them in one range. */
+  Vector<PosNorLoop> range_data;
+  int f_start = 0;
+  while (f_start < bm->totface) {
+    if (!face_changed[f_start]) {
+      f_start++;
+      continue;
+    }
+    int f_end = f_start + 1;
+    while (f_end < bm->totface && face_changed[f_end]) {
+      f_end++;
+    }
+
+    range_data.clear();
+    for (const int f : IndexRange(f_start, f_end - f_start)) {
+      const BMFace *efa = BM_face_at_index(bm, f);
+      BMLoop *l_iter, *l_first;
+      l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
+      do {
+        PosNorLoop vert;
+        copy_v3_v3(vert.pos, l_iter->v->co);
+        vert.nor = deform_cache->vert_nor[BM_elem_index_get(l_iter->v)];
+        vert.nor.w = BM_elem_flag_test(efa, BM_ELEM_HIDDEN) ? -1 : 0;
+        range_data.append(vert);
+      } while ((l_iter = l_iter->next) != l_first);
+    }
+
+    const int l_start = BM_elem_index_get(BM_FACE_FIRST_LOOP(BM_face_at_index(bm, f_start)));
+    GPU_vertbuf_update_sub(vbo,
+                           l_start * sizeof(PosNorLoop),
+                           range_data.size() * sizeof(PosNorLoop),
+                           range_data.data());
+    f_start = f_end;
+  }
+
+  /* Loose geometry is stored after the loops. */
+  const MeshExtractLooseGeom *loose_geom = &mbc->loose_geom;
+  for (const int i : IndexRange(loose_geom->edge_len)) {
+    const BMEdge *eed = BM_edge_at_index(bm, loose_geom->edges[i]);
+    const int v1 = BM_elem_index_get(eed->v1);
+    const int v2 = BM_elem_index_get(eed->v2);
+    if (!vert_changed[v1] && !vert_changed[v2]) {
+      continue;
+    }
+    PosNorLoop edge_data[2];
+    copy_v3_v3(edge_data[0].pos, eed->v1->co);
+    copy_v3_v3(edge_data[1].pos, eed->v2->co);
+    edge_data[0].nor = deform_cache->vert_nor[v1];
+    edge_data[1].nor = deform_cache->vert_nor[v2];
+    GPU_vertbuf_update_sub(
+        vbo, (bm->totloop + i * 2) * sizeof(PosNorLoop), sizeof(edge_data), edge_data);
+  }
+
+  const int lvert_offset = bm->totloop + loose_geom->edge_len * 2;
+  for (const int i : IndexRange(loose_geom->vert_len)) {
+    const int v = loose_geom->verts[i];
+    if (!vert_changed[v]) {
+      continue;
+    }
+    PosNorLoop vert_data;
+    copy_v3_v3(vert_data.pos, deform_cache->vert_co[v]);
+    vert_data.nor = deform_cache->vert_nor[v];
+    GPU_vertbuf_update_sub(
+        vbo, (lvert_offset + i) * sizeof(PosNorLoop), sizeof(vert_data), &vert_data);
+  }
+}
+
+/** \} */
+
 }  // namespace blender::draw
 
 extern "C" {
 const MeshExtract extract_pos_nor = blender::draw::create_extractor_pos_nor();
 const MeshExtract extract_pos_nor_hq = blender::draw::create_extractor_pos_nor_hq();
+
+void mesh_deform_cache_update(MeshDeformCache **deform_cache, BMesh *bm)
+{
+  blender::draw::deform_cache_update(deform_cache, bm);
+}
+
+void mesh_deform_cache_free(MeshDeformCache **deform_cache)
+{
+  blender::draw::deform_cache_free(deform_cache);
+}
+
+bool extract_pos_nor_update_deform_supported(const MeshBufferCache *mbc,
+                                             const MeshDeformCache *deform_cache,
+                                             const BMesh *bm)
+{
+  return blender::draw::pos_nor_update_deform_supported(mbc, deform_cache, bm);
+}
+
+void extract_pos_nor_update_deform(MeshBufferCache *mbc,
+                                   MeshDeformCache *deform_cache,
+                                   BMesh *bm)
+{
+  blender::draw::pos_nor_update_deform(mbc, deform_cache, bm);
+}
 }
@@ -38,6 +38,7 @@ static bool mesh_extract_uv_format_init(GPUVertFormat *format,
                                         struct MeshBatchCache *cache,
                                         CustomData *cd_ldata,
                                         eMRExtractType extract_type,
+                                        const bool use_compressed,
                                         uint32_t &r_uv_layers)
 {
   GPU_vertformat_deinterleave(format);
@@ -61,7 +62,8 @@ static bool mesh_extract_uv_format_init(GPUVertFormat *format,
       GPU_vertformat_safe_attr_name(layer_name, attr_safe_name, GPU_MAX_SAFE_ATTR_NAME);
       /* UV layer name. */
       BLI_snprintf(attr_name, sizeof(attr_name), "u%s", attr_safe_name);
-      GPU_vertformat_attr_add(format, attr_name, GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
+      GPU_vertformat_attr_add(
+          format, attr_name, use_compressed ? GPU_COMP_F16 : GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
       /* Auto layer name. */
       BLI_snprintf(attr_name, sizeof(attr_name), "a%s", attr_safe_name);
       GPU_vertformat_alias_add(format, attr_name);
@@ -90,26 +92,22 @@ static bool mesh_extract_uv_format_init(GPUVertFormat *format,
   return true;
 }
 
-static void extract_uv_init(const MeshRenderData *mr,
-                            struct MeshBatchCache *cache,
-                            void *buf,
-                            void *UNUSED(tls_data))
+BLI_INLINE void extract_uv_store(float (*r_uv)[2], const float uv[2])
 {
-  GPUVertBuf *vbo = static_cast<GPUVertBuf *>(buf);
-  GPUVertFormat format = {0};
-
-  CustomData *cd_ldata = (mr->extract_type == MR_EXTRACT_BMESH) ? &mr->bm->ldata : &mr->me->ldata;
-  int v_len = mr->loop_len;
-  uint32_t uv_layers = cache->cd_used.uv;
-  if (!mesh_extract_uv_format_init(&format, cache, cd_ldata, mr->extract_type, uv_layers)) {
-    /* VBO will not be used, only allocate minimum of memory. */
-    v_len = 1;
-  }
+  copy_v2_v2(*r_uv, uv);
+}
 
-  GPU_vertbuf_init_with_format(vbo, &format);
-  GPU_vertbuf_data_alloc(vbo, v_len);
+BLI_INLINE void extract_uv_store(ushort (*r_uv)[2], const float uv[2])
+{
+  GPU_half_convert_v2(*r_uv, uv);
+}
 
-  float(*uv_data)[2] = (float(*)[2])GPU_vertbuf_get_data(vbo);
+template<typename UVType>
+static void extract_uv_layers_fill(const MeshRenderData *mr,
+                                   CustomData *cd_ldata,
+                                   const uint32_t uv_layers,
+                                   UVType *uv_data)
+{
   for (int i = 0; i < MAX_MTFACE; i++) {
     if (uv_layers & (1 << i)) {
       if (mr->extract_type == MR_EXTRACT_BMESH) {
@@ -121,7 +119,7 @@ static void extract_uv_init(const MeshRenderData *mr,
           l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
           do {
             MLoopUV *luv = (MLoopUV *)BM_ELEM_CD_GET_VOID_P(l_iter, cd_ofs);
-            memcpy(uv_data, luv->uv, sizeof(*uv_data));
+            extract_uv_store(uv_data, luv->uv);
             uv_data++;
           } while ((l_iter = l_iter->next) != l_first);
         }
@@ -129,13 +127,50 @@ static void extract_uv_init(const MeshRenderData *mr,
       else {
         MLoopUV *layer_data = (MLoopUV *)CustomData_get_layer_n(cd_ldata, CD_MLOOPUV, i);
         for (int ml_index = 0; ml_index < mr->loop_len; ml_index++, uv_data++, layer_data++) {
-          memcpy(uv_data, layer_data->uv, sizeof(*uv_data));
+          extract_uv_store(uv_data, layer_data->uv);
         }
       }
     }
   }
 }
 
+static void extract_uv_init_ex(const MeshRenderData *mr,
+                               struct MeshBatchCache *cache,
+                               void *buf,
+                               const bool use_compressed)
+{
+  GPUVertBuf *vbo = static_cast<GPUVertBuf *>(buf);
+  GPUVertFormat format = {0};
+
+  CustomData *cd_ldata = (mr->extract_type == MR_EXTRACT_BMESH) ? &mr->bm->ldata : &mr->me->ldata;
+  int v_len = mr->loop_len;
+  uint32_t uv_layers = cache->cd_used.uv;
+  if (!mesh_extract_uv_format_init(
+          &format, cache, cd_ldata, mr->extract_type, use_compressed, uv_layers)) {
+    /* VBO will not be used, only allocate minimum of memory. */
+    v_len = 1;
+  }
+
+  GPU_vertbuf_init_with_format(vbo, &format);
+  GPU_vertbuf_data_alloc(vbo, v_len);
+
+  void *uv_data = GPU_vertbuf_get_data(vbo);
+  if (use_compressed) {
+    extract_uv_layers_fill(mr, cd_ldata, uv_layers, static_cast<ushort(*)[2]>(uv_data));
+  }
+  else {
+    extract_uv_layers_fill(mr, cd_ldata, uv_layers, static_cast<float(*)[2]>(uv_data));
+  }
+}
+
+static void extract_uv_init(const MeshRenderData *mr,
+                            struct MeshBatchCache *cache,
+                            void *buf,
+                            void *UNUSED(tls_data))
+{
+  extract_uv_init_ex(mr, cache, buf, false);
+}
+
 static void extract_uv_init_subdiv(const DRWSubdivCache *subdiv_cache,
                                    const MeshRenderData *UNUSED(mr),
                                    struct MeshBatchCache *cache,
@@ -149,7 +184,7 @@ static void extract_uv_init_subdiv(const DRWSubdivCache *subdiv_cache,
   uint v_len = subdiv_cache->num_subdiv_loops;
   uint uv_layers;
   if (!mesh_extract_uv_format_init(
-          &format, cache, &coarse_mesh->ldata, MR_EXTRACT_MESH, uv_layers)) {
+          &format, cache, &coarse_mesh->ldata, MR_EXTRACT_MESH, false, uv_layers)) {
     // TODO(kevindietrich): handle this more gracefully.
     v_len = 1;
   }
@@ -184,8 +219,38 @@ constexpr MeshExtract create_extractor_uv()
 
 /** \} */
 
+/* ---------------------------------------------------------------------- */
+/** \name Extract Compressed UV layers
+ *
+ * Same as #extract_uv but stores the coordinates as half floats, the GPU converts them back
+ * when fetching so shaders are unaffected.
+ * \{ */
+
+static void extract_uv_compressed_init(const MeshRenderData *mr,
+                                       struct MeshBatchCache *cache,
+                                       void *buf,
+                                       void *UNUSED(tls_data))
+{
+  extract_uv_init_ex(mr, cache, buf, true);
+}
+
+constexpr MeshExtract create_extractor_uv_compressed()
+{
+  MeshExtract extractor = {nullptr};
+  extractor.init = extract_uv_compressed_init;
+  extractor.init_subdiv = extract_uv_init_subdiv;
+  extractor.data_type = MR_DATA_NONE;
+  extractor.data_size = 0;
+  extractor.use_threading = false;
+  extractor.mesh_buffer_offset = offsetof(MeshBufferList, vbo.uv);
+  return extractor;
+}
+
+/** \} */
+
 }  // namespace blender::draw
 
 extern "C" {
 const MeshExtract extract_uv = blender::draw::create_extractor_uv();
+const MeshExtract extract_uv_compressed = blender::draw::create_extractor_uv_compressed();
 }
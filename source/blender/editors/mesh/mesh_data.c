@@ -1032,6 +1032,7 @@ static int mesh_customdata_custom_splitnormals_add_exec(bContext *C, wmOperator
       }
 
       CustomData_add_layer(data, CD_CUSTOMLOOPNORMAL, CD_DEFAULT, NULL, me->totloop);
+      BKE_mesh_loop_normals_tag_dirty(me);
     }
 
     DEG_id_tag_update(&me->id, 0);
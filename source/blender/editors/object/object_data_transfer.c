@@ -34,6 +34,7 @@
 #include "BKE_context.h"
 #include "BKE_data_transfer.h"
 #include "BKE_deform.h"
+#include "BKE_mesh.h"
 #include "BKE_mesh_mapping.h"
 #include "BKE_mesh_remap.h"
 #include "BKE_mesh_runtime.h"
@@ -488,6 +489,7 @@ static int data_transfer_exec(bContext *C, wmOperator *op)
 
         if (data_type == DT_TYPE_LNOR && use_create) {
           ((Mesh *)ob_dst->data)->flag |= ME_AUTOSMOOTH;
+          BKE_mesh_loop_normals_tag_dirty(ob_dst->data);
         }
 
         DEG_id_tag_update(&ob_dst->id, ID_RECALC_GEOMETRY);
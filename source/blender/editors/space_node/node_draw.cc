@@ -40,6 +40,7 @@
 #include "BLI_map.hh"
 #include "BLI_set.hh"
 #include "BLI_span.hh"
+#include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
@@ -1625,6 +1626,28 @@ static std::string node_get_execution_time_label(const SpaceNode &snode, const b
   return stream.str() + " ms";
 }
 
+/* Thread and memory usage of a single node, empty when it was not executed. */
+static std::string node_get_execution_usage_label(const SpaceNode &snode, const bNode &node)
+{
+  if (ELEM(node.type, NODE_GROUP, NODE_FRAME, NODE_GROUP_OUTPUT)) {
+    return std::string("");
+  }
+  const geo_log::NodeLog *node_log = geo_log::ModifierLog::find_node_by_node_editor_context(snode,
+                                                                                            node);
+  if (node_log == nullptr || node_log->execution_time().count() == 0) {
+    return std::string("");
+  }
+
+  char memory_str[15];
+  const int64_t memory_delta = node_log->execution_memory_delta();
+  BLI_str_format_byte_unit(memory_str, memory_delta, false);
+
+  std::stringstream stream;
+  stream << std::fixed << std::setprecision(1) << node_log->execution_threads_used()
+         << " " << TIP_("threads") << ", " << (memory_delta > 0 ? "+" : "") << memory_str;
+  return stream.str();
+}
+
 struct NodeExtraInfoRow {
   std::string text;
   const char *tooltip;
@@ -1650,6 +1673,16 @@ static Vector<NodeExtraInfoRow> node_get_extra_info(const SpaceNode &snode, cons
       row.icon = ICON_PREVIEW_RANGE;
       rows.append(std::move(row));
     }
+
+    NodeExtraInfoRow usage_row;
+    usage_row.text = node_get_execution_usage_label(snode, node);
+    if (!usage_row.text.empty()) {
+      usage_row.tooltip = TIP_(
+          "The average number of busy threads and the change of allocated memory during the "
+          "node's latest evaluation. Other nodes executed at the same time are included");
+      usage_row.icon = ICON_MEMORY;
+      rows.append(std::move(usage_row));
+    }
   }
   const geo_log::NodeLog *node_log = geo_log::ModifierLog::find_node_by_node_editor_context(snode,
                                                                                             node);
@@ -139,12 +139,16 @@ static void tc_mesh_customdata_free(struct TransCustomDataMesh *tcmd)
 }
 
 static void tc_mesh_customdata_free_fn(struct TransInfo *UNUSED(t),
-                                       struct TransDataContainer *UNUSED(tc),
+                                       struct TransDataContainer *tc,
                                        struct TransCustomData *custom_data)
 {
   struct TransCustomDataMesh *tcmd = custom_data->data;
   tc_mesh_customdata_free(tcmd);
   custom_data->data = NULL;
+
+  /* Operations after transform (auto-merge for example) may change the topology. */
+  BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
+  em->is_deform_update = false;
 }
 
 /** \} */
@@ -2090,6 +2094,11 @@ void recalcData_mesh(TransInfo *t)
     DEG_id_tag_update(tc->obedit->data, ID_RECALC_GEOMETRY);
 
     tc_mesh_partial_update(t, tc, &partial_state);
+
+    /* Only vertices move, unless custom-data (UV's for example) is corrected as well. */
+    struct TransCustomDataMesh *tcmd = tc->custom.type.data;
+    BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
+    em->is_deform_update = (tcmd->cd_layer_correct == NULL);
   }
 }
 
@@ -33,6 +33,14 @@ struct RealizeInstancesOptions {
    * instances. Otherwise, instance attributes are ignored.
    */
   bool realize_instance_attributes = true;
+  /**
+   * When set, only generic attributes contained in this set are gathered and propagated to the
+   * realized geometry. Callers that know which attributes are used further down the line can use
+   * this to avoid copying attributes that would be discarded anyway. Built-in attributes that are
+   * required by the geometry type (e.g. positions, or the radius of points and curves) are always
+   * realized. The set has to outlive the call to #realize_instances.
+   */
+  const Set<bke::AttributeIDRef> *attributes_to_propagate = nullptr;
 };
 
 /**
@@ -47,6 +55,12 @@ struct RealizeInstancesOptions {
  */
 GeometrySet realize_instances(GeometrySet geometry_set, const RealizeInstancesOptions &options);
 
-GeometrySet realize_instances_legacy(GeometrySet geometry_set);
+/**
+ * Realize instances the way legacy nodes expect, without instance attributes and keeping the
+ * original ids. Only the given generic attributes are propagated when the set is provided, see
+ * #RealizeInstancesOptions::attributes_to_propagate.
+ */
+GeometrySet realize_instances_legacy(
+    GeometrySet geometry_set, const Set<bke::AttributeIDRef> *attributes_to_propagate = nullptr);
 
 }  // namespace blender::geometry
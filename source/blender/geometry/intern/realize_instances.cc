@@ -243,6 +243,19 @@ struct InstanceContext {
   }
 };
 
+/**
+ * Checks whether the attribute is used after realization. When the caller did not provide the set
+ * of used attributes, all attributes are propagated.
+ */
+static bool attribute_is_requested(const RealizeInstancesOptions &options,
+                                   const AttributeIDRef &attribute_id)
+{
+  if (options.attributes_to_propagate == nullptr) {
+    return true;
+  }
+  return options.attributes_to_propagate->contains(attribute_id);
+}
+
 /* -------------------------------------------------------------------- */
 /** \name Gather Realize Tasks
  * \{ */
@@ -509,8 +522,18 @@ static OrderedAttributes gather_generic_pointcloud_attributes_to_propagate(
       src_component_types, GEO_COMPONENT_TYPE_POINT_CLOUD, true, attributes_to_propagate);
   attributes_to_propagate.remove("position");
   r_create_id = attributes_to_propagate.pop_try("id").has_value();
+  /* The radius is stored like a generic attribute, but it is needed to display and render the
+   * points, so it is always realized like the built-in curve radius. */
+  const std::optional<AttributeKind> radius_kind = attributes_to_propagate.pop_try("radius");
   OrderedAttributes ordered_attributes;
+  if (radius_kind) {
+    ordered_attributes.ids.add_new("radius");
+    ordered_attributes.kinds.append(*radius_kind);
+  }
   for (const auto item : attributes_to_propagate.items()) {
+    if (!attribute_is_requested(options, item.key)) {
+      continue;
+    }
     ordered_attributes.ids.add_new(item.key);
     ordered_attributes.kinds.append(item.value);
   }
@@ -730,6 +753,9 @@ static OrderedAttributes gather_generic_mesh_attributes_to_propagate(
   r_create_id = attributes_to_propagate.pop_try("id").has_value();
   OrderedAttributes ordered_attributes;
   for (const auto item : attributes_to_propagate.items()) {
+    if (!attribute_is_requested(options, item.key)) {
+      continue;
+    }
     ordered_attributes.ids.add_new(item.key);
     ordered_attributes.kinds.append(item.value);
   }
@@ -1045,6 +1071,9 @@ static OrderedAttributes gather_generic_curve_attributes_to_propagate(
   r_create_id = attributes_to_propagate.pop_try("id").has_value();
   OrderedAttributes ordered_attributes;
   for (const auto item : attributes_to_propagate.items()) {
+    if (!attribute_is_requested(options, item.key)) {
+      continue;
+    }
     ordered_attributes.ids.add_new(item.key);
     ordered_attributes.kinds.append(item.value);
   }
@@ -1334,11 +1363,13 @@ GeometrySet realize_instances(GeometrySet geometry_set, const RealizeInstancesOp
   return new_geometry_set;
 }
 
-GeometrySet realize_instances_legacy(GeometrySet geometry_set)
+GeometrySet realize_instances_legacy(GeometrySet geometry_set,
+                                     const Set<bke::AttributeIDRef> *attributes_to_propagate)
 {
   RealizeInstancesOptions options;
   options.keep_original_ids = true;
   options.realize_instance_attributes = false;
+  options.attributes_to_propagate = attributes_to_propagate;
   return realize_instances(std::move(geometry_set), options);
 }
 
@@ -0,0 +1,78 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include "BKE_idtype.h"
+#include "BKE_pointcloud.h"
+
+#include "GEO_realize_instances.hh"
+
+namespace blender::geometry::tests {
+
+using bke::AttributeIDRef;
+
+class RealizeInstancesTest : public testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+
+  /* Two instances of a point cloud with the generic attributes "a" and "b". */
+  static GeometrySet create_instances()
+  {
+    GeometrySet pointcloud_set = GeometrySet::create_with_pointcloud(
+        BKE_pointcloud_new_nomain(2));
+    PointCloudComponent &pointcloud =
+        pointcloud_set.get_component_for_write<PointCloudComponent>();
+    for (const char *name : {"a", "b"}) {
+      pointcloud.attribute_try_create(
+          name, ATTR_DOMAIN_POINT, CD_PROP_FLOAT, AttributeInitDefault());
+    }
+
+    GeometrySet geometry_set;
+    InstancesComponent &instances = geometry_set.get_component_for_write<InstancesComponent>();
+    const int handle = instances.add_reference(InstanceReference{pointcloud_set});
+    instances.add_instance(handle, float4x4::identity());
+    instances.add_instance(handle, float4x4::identity());
+    return geometry_set;
+  }
+};
+
+TEST_F(RealizeInstancesTest, all_attributes_by_default)
+{
+  const GeometrySet realized = realize_instances(create_instances(), {});
+  const PointCloudComponent &pointcloud = *realized.get_component_for_read<PointCloudComponent>();
+  EXPECT_EQ(pointcloud.attribute_domain_size(ATTR_DOMAIN_POINT), 4);
+  EXPECT_TRUE(pointcloud.attribute_exists("a"));
+  EXPECT_TRUE(pointcloud.attribute_exists("b"));
+}
+
+TEST_F(RealizeInstancesTest, only_requested_attributes)
+{
+  const Set<AttributeIDRef> attributes_to_propagate = {"a"};
+  RealizeInstancesOptions options;
+  options.attributes_to_propagate = &attributes_to_propagate;
+
+  const GeometrySet realized = realize_instances(create_instances(), options);
+  const PointCloudComponent &pointcloud = *realized.get_component_for_read<PointCloudComponent>();
+  EXPECT_EQ(pointcloud.attribute_domain_size(ATTR_DOMAIN_POINT), 4);
+  EXPECT_TRUE(pointcloud.attribute_exists("position"));
+  EXPECT_TRUE(pointcloud.attribute_exists("a"));
+  EXPECT_FALSE(pointcloud.attribute_exists("b"));
+}
+
+TEST_F(RealizeInstancesTest, no_requested_attributes)
+{
+  const Set<AttributeIDRef> attributes_to_propagate;
+  const GeometrySet realized = realize_instances_legacy(create_instances(),
+                                                        &attributes_to_propagate);
+  const PointCloudComponent &pointcloud = *realized.get_component_for_read<PointCloudComponent>();
+  EXPECT_EQ(pointcloud.attribute_domain_size(ATTR_DOMAIN_POINT), 4);
+  EXPECT_TRUE(pointcloud.attribute_exists("position"));
+  EXPECT_TRUE(pointcloud.attribute_exists("radius"));
+  EXPECT_FALSE(pointcloud.attribute_exists("a"));
+  EXPECT_FALSE(pointcloud.attribute_exists("b"));
+}
+
+}  // namespace blender::geometry::tests
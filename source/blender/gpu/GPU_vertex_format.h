@@ -52,6 +52,8 @@ typedef enum {
   GPU_COMP_F32,
 
   GPU_COMP_I10,
+  /* Half float, only to be used with #GPU_FETCH_FLOAT. */
+  GPU_COMP_F16,
   /* Warning! adjust GPUVertAttr if changing. */
 } GPUVertCompType;
 
@@ -67,7 +69,7 @@ typedef struct GPUVertAttr {
   /* GPUVertFetchMode */
   uint fetch_mode : 2;
   /* GPUVertCompType */
-  uint comp_type : 3;
+  uint comp_type : 4;
   /* 1 to 4 or 8 or 12 or 16 */
   uint comp_len : 5;
   /* size in bytes, 1 to 64 */
@@ -214,6 +216,43 @@ BLI_INLINE int gpu_convert_i16_to_i10(short x)
   return x >> 6;
 }
 
+/* Round to nearest even. Values outside of the half float range become infinite. */
+BLI_INLINE ushort gpu_convert_f32_to_f16(float x)
+{
+  union {
+    float f;
+    uint u;
+  } in, denorm_magic;
+  in.f = x;
+  const uint sign = in.u & 0x80000000u;
+  in.u ^= sign;
+
+  ushort result;
+  if (in.u >= 0x47800000u) {
+    /* Infinite or NaN. */
+    result = (in.u > 0x7f800000u) ? 0x7e00 : 0x7c00;
+  }
+  else if (in.u < 0x38800000u) {
+    /* Denormal or zero, let the FPU do the rounding. */
+    denorm_magic.u = ((127 - 15) + (23 - 10) + 1) << 23;
+    in.f += denorm_magic.f;
+    result = (ushort)(in.u - denorm_magic.u);
+  }
+  else {
+    const uint mantissa_odd = (in.u >> 13) & 1;
+    in.u += ((uint)(15 - 127) << 23) + 0xfff;
+    in.u += mantissa_odd;
+    result = (ushort)(in.u >> 13);
+  }
+  return (ushort)(result | (sign >> 16));
+}
+
+BLI_INLINE void GPU_half_convert_v2(ushort r[2], const float data[2])
+{
+  r[0] = gpu_convert_f32_to_f16(data[0]);
+  r[1] = gpu_convert_f32_to_f16(data[1]);
+}
+
 BLI_INLINE GPUPackedNormal GPU_normal_convert_i10_v3(const float data[3])
 {
   GPUPackedNormal n = {
@@ -523,6 +523,8 @@ static inline eGPUTextureFormat to_texture_format(const GPUVertFormat *format)
           return GPU_R32UI;
         case GPU_COMP_F32:
           return GPU_R32F;
+        case GPU_COMP_F16:
+          return GPU_R16F;
         default:
           break;
       }
@@ -543,6 +545,8 @@ static inline eGPUTextureFormat to_texture_format(const GPUVertFormat *format)
           return GPU_RG32UI;
         case GPU_COMP_F32:
           return GPU_RG32F;
+        case GPU_COMP_F16:
+          return GPU_RG16F;
         default:
           break;
       }
@@ -577,6 +581,8 @@ static inline eGPUTextureFormat to_texture_format(const GPUVertFormat *format)
           return GPU_RGBA32UI;
         case GPU_COMP_F32:
           return GPU_RGBA32F;
+        case GPU_COMP_F16:
+          return GPU_RGBA16F;
         default:
           break;
       }
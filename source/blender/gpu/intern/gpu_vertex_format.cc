@@ -67,6 +67,9 @@ void GPU_vertformat_copy(GPUVertFormat *dest, const GPUVertFormat *src)
 
 static uint comp_sz(GPUVertCompType type)
 {
+  if (type == GPU_COMP_F16) {
+    return 2;
+  }
 #if TRUST_NO_ONE
   assert(type <= GPU_COMP_F32); /* other types have irregular sizes (not bytes) */
 #endif
@@ -143,6 +146,7 @@ uint GPU_vertformat_attr_add(GPUVertFormat *format,
 
   switch (comp_type) {
     case GPU_COMP_F32:
+    case GPU_COMP_F16:
       /* float type can only kept as float */
       assert(fetch_mode == GPU_FETCH_FLOAT);
       break;
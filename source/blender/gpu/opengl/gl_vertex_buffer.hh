@@ -104,6 +104,8 @@ static inline GLenum to_gl(GPUVertCompType type)
       return GL_FLOAT;
     case GPU_COMP_I10:
       return GL_INT_2_10_10_10_REV;
+    case GPU_COMP_F16:
+      return GL_HALF_FLOAT;
     default:
       BLI_assert(0);
       return GL_FLOAT;
@@ -62,6 +62,12 @@ typedef struct CustomDataLayer {
    * automatically.
    */
   const struct AnonymousAttributeID *anonymous_id;
+  /**
+   * Run-time owner of the data array when it is shared with layers of other geometries, to avoid
+   * copying it. Shared layers are also tagged with #CD_FLAG_NOFREE, so that they are copied
+   * before they are modified, like referenced layers.
+   */
+  struct CustomDataLayerSharing *sharing;
 } CustomDataLayer;
 
 #define MAX_CUSTOMDATA_LAYER_NAME 64
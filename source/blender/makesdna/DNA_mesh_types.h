@@ -46,6 +46,7 @@ struct MPoly;
 struct MVert;
 struct Material;
 struct Mesh;
+struct MeshTopologyCache;
 struct SubdivCCG;
 
 #
@@ -70,8 +71,19 @@ struct MLoopTri_Store {
    * (where data is actually computed)
    * shall always be protected by same lock as one used for looptris computing. */
   struct MLoopTri *array, *array_wip;
+  /**
+   * Set when #array is shared with copies of the mesh that have the same topology. A shared array
+   * is never modified, it is copied first. Defined in `mesh_runtime.c`.
+   */
+  struct MeshLoopTriSharing *sharing;
   int len;
   int len_alloc;
+  /**
+   * Vertex positions changed since #array was calculated, while the topology stayed the same.
+   * Only quads and n-gons need to be re-triangulated in that case.
+   */
+  char positions_dirty;
+  char _pad[7];
 };
 
 /** Runtime data, not saved in files. */
@@ -107,6 +119,9 @@ typedef struct Mesh_Runtime {
   /** Cache of non-manifold boundary data for Shrinkwrap Target Project. */
   struct ShrinkwrapBoundaryData *shrinkwrap_data;
 
+  /** Lazily computed adjacency maps and islands. Defined in `mesh_topology.cc`. */
+  struct MeshTopologyCache *topology_cache;
+
   /** Needed in case we need to lazily initialize the mesh. */
   CustomData_MeshMasks cd_mask_extra;
 
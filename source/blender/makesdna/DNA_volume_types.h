@@ -56,6 +56,8 @@ typedef struct VolumeRender {
   int space;
   float step_size;
   float clipping;
+  int flag;
+  char _pad[4];
 } VolumeRender;
 
 typedef struct Volume {
@@ -129,6 +131,11 @@ typedef enum VolumeRenderSpace {
   VOLUME_SPACE_WORLD = 1,
 } VolumeRenderSpace;
 
+/** #VolumeRender.flag */
+enum {
+  VOLUME_RENDER_SKIP_EMPTY_SPACE = (1 << 0),
+};
+
 /** #VolumeDisplay.interpolation_method */
 typedef enum VolumeDisplayInterpMethod {
   VOLUME_DISPLAY_INTERP_LINEAR = 0,
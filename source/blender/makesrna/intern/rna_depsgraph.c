@@ -254,6 +254,16 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_trace_begin(int max_events)
+{
+  DEG_debug_trace_begin(max_events);
+}
+
+static bool rna_Depsgraph_debug_trace_end(const char *filename)
+{
+  return DEG_debug_trace_end(filename);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -667,6 +677,30 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_trace_begin", "rna_Depsgraph_debug_trace_begin");
+  RNA_def_function_ui_description(
+      func, "Start recording the evaluation of operations of all dependency graphs");
+  RNA_def_function_flag(func, FUNC_NO_SELF);
+  RNA_def_int(func,
+              "max_events",
+              0,
+              0,
+              INT_MAX,
+              "Max Events",
+              "Number of the newest events to keep, zero for the default",
+              0,
+              1 << 24);
+
+  func = RNA_def_function(srna, "debug_trace_end", "rna_Depsgraph_debug_trace_end");
+  RNA_def_function_ui_description(
+      func, "Stop recording and write the evaluated operations to a Chrome trace JSON file");
+  RNA_def_function_flag(func, FUNC_NO_SELF);
+  parm = RNA_def_string_file_path(
+      func, "filename", NULL, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
+  parm = RNA_def_boolean(func, "result", false, "Result", "Whether the trace was written");
+  RNA_def_function_return(func, parm);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
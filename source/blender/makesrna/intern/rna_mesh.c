@@ -252,6 +252,24 @@ static void rna_Mesh_update_geom_and_params(Main *UNUSED(bmain),
   WM_main_add_notifier(NC_GEOM | ND_DATA, id);
 }
 
+/**
+ * Edge and face flags and auto smooth settings only affect split normals, which are tagged
+ * before the no-user check, since they may be calculated on meshes without users as well.
+ */
+static void rna_Mesh_update_data_split_normals(Main *bmain, Scene *scene, PointerRNA *ptr)
+{
+  BKE_mesh_loop_normals_tag_dirty(rna_mesh(ptr));
+  rna_Mesh_update_data_legacy_deg_tag_all(bmain, scene, ptr);
+}
+
+static void rna_Mesh_update_geom_and_params_split_normals(Main *bmain,
+                                                          Scene *scene,
+                                                          PointerRNA *ptr)
+{
+  BKE_mesh_loop_normals_tag_dirty(rna_mesh(ptr));
+  rna_Mesh_update_geom_and_params(bmain, scene, ptr);
+}
+
 static void rna_Mesh_update_data_edit_weight(Main *bmain, Scene *scene, PointerRNA *ptr)
 {
   BKE_mesh_batch_cache_dirty_tag(rna_mesh(ptr), BKE_MESH_BATCH_DIRTY_ALL);
@@ -1803,7 +1821,7 @@ static void rna_def_medge(BlenderRNA *brna)
   prop = RNA_def_property(srna, "use_edge_sharp", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", ME_SHARP);
   RNA_def_property_ui_text(prop, "Sharp", "Sharp edge for the Edge Split modifier");
-  RNA_def_property_update(prop, 0, "rna_Mesh_update_data_legacy_deg_tag_all");
+  RNA_def_property_update(prop, 0, "rna_Mesh_update_data_split_normals");
 
   prop = RNA_def_property(srna, "is_loose", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", ME_LOOSEEDGE);
@@ -2011,7 +2029,7 @@ static void rna_def_mpolygon(BlenderRNA *brna)
   prop = RNA_def_property(srna, "use_smooth", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", ME_SMOOTH);
   RNA_def_property_ui_text(prop, "Smooth", "");
-  RNA_def_property_update(prop, 0, "rna_Mesh_update_data_legacy_deg_tag_all");
+  RNA_def_property_update(prop, 0, "rna_Mesh_update_data_split_normals");
 
   prop = RNA_def_property(srna, "use_freestyle_mark", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_funcs(
@@ -3364,7 +3382,7 @@ static void rna_def_mesh(BlenderRNA *brna)
       "Auto Smooth",
       "Auto smooth (based on smooth/sharp faces/edges and angle between faces), "
       "or use custom split normals data if available");
-  RNA_def_property_update(prop, 0, "rna_Mesh_update_geom_and_params");
+  RNA_def_property_update(prop, 0, "rna_Mesh_update_geom_and_params_split_normals");
 
   prop = RNA_def_property(srna, "auto_smooth_angle", PROP_FLOAT, PROP_ANGLE);
   RNA_def_property_float_sdna(prop, NULL, "smoothresh");
@@ -3373,7 +3391,7 @@ static void rna_def_mesh(BlenderRNA *brna)
                            "Auto Smooth Angle",
                            "Maximum angle between face normals that will be considered as smooth "
                            "(unused if custom split normals data are available)");
-  RNA_def_property_update(prop, 0, "rna_Mesh_update_geom_and_params");
+  RNA_def_property_update(prop, 0, "rna_Mesh_update_geom_and_params_split_normals");
 
   RNA_define_verify_sdna(false);
   prop = RNA_def_property(srna, "has_custom_normals", PROP_BOOLEAN, PROP_NONE);
@@ -62,9 +62,19 @@ static void rna_Mesh_create_normals_split(Mesh *mesh)
   if (!CustomData_has_layer(&mesh->ldata, CD_NORMAL)) {
     CustomData_add_layer(&mesh->ldata, CD_NORMAL, CD_CALLOC, NULL, mesh->totloop);
     CustomData_set_layer_flag(&mesh->ldata, CD_NORMAL, CD_FLAG_TEMPORARY);
+    /* The empty layer must not be mistaken for calculated normals. */
+    BKE_mesh_normals_tag_dirty(mesh);
   }
 }
 
+static void rna_Mesh_calc_normals_split(Mesh *mesh)
+{
+  /* Edges and faces may have been changed through the API without tagging the normals dirty,
+   * always recalculate when requested explicitly. */
+  BKE_mesh_normals_tag_dirty(mesh);
+  BKE_mesh_calc_normals_split(mesh);
+}
+
 static void rna_Mesh_free_normals_split(Mesh *mesh)
 {
   CustomData_free_layers(&mesh->ldata, CD_NORMAL, mesh->totloop);
@@ -239,7 +249,7 @@ void RNA_api_mesh(StructRNA *srna)
   func = RNA_def_function(srna, "create_normals_split", "rna_Mesh_create_normals_split");
   RNA_def_function_ui_description(func, "Empty split vertex normals");
 
-  func = RNA_def_function(srna, "calc_normals_split", "BKE_mesh_calc_normals_split");
+  func = RNA_def_function(srna, "calc_normals_split", "rna_Mesh_calc_normals_split");
   RNA_def_function_ui_description(func,
                                   "Calculate split vertex normals, which preserve sharp edges");
 
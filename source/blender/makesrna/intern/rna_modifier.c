@@ -33,6 +33,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_math.h"
+#include "BLI_path_util.h"
 
 #include "BLT_translation.h"
 
@@ -1656,6 +1657,19 @@ static void rna_NodesModifier_node_group_update(Main *bmain, Scene *scene, Point
   MOD_nodes_update_interface(object, nmd);
 }
 
+static void rna_NodesModifier_write_profile_trace(NodesModifierData *nmd,
+                                                 ReportList *reports,
+                                                 const char *filepath)
+{
+  if (nmd->runtime_eval_log == NULL) {
+    BKE_report(reports, RPT_ERROR, "The modifier has not been evaluated yet");
+    return;
+  }
+  if (!MOD_nodes_write_profile_trace(nmd, filepath)) {
+    BKE_reportf(reports, RPT_ERROR, "Could not write profile trace to '%s'", filepath);
+  }
+}
+
 static IDProperty **rna_NodesModifier_properties(PointerRNA *ptr)
 {
   NodesModifierData *nmd = ptr->data;
@@ -6929,6 +6943,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   srna = RNA_def_struct(brna, "NodesModifier", "Modifier");
   RNA_def_struct_ui_text(srna, "Nodes Modifier", "");
@@ -6945,6 +6961,15 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
   RNA_def_property_update(prop, 0, "rna_NodesModifier_node_group_update");
 
   RNA_define_lib_overridable(false);
+
+  func = RNA_def_function(
+      srna, "write_profile_trace", "rna_NodesModifier_write_profile_trace");
+  RNA_def_function_ui_description(func,
+                                  "Write the execution time, CPU time, thread and memory usage of "
+                                  "every node from the latest evaluation to a Chrome trace file");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(func, "filepath", NULL, FILE_MAX, "", "File path to write to");
+  RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 }
 
 static void rna_def_modifier_mesh_to_volume(BlenderRNA *brna)
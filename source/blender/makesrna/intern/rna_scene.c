@@ -6133,6 +6133,16 @@ static void rna_def_scene_render_data(BlenderRNA *brna)
                            "Use high quality tangent space at the cost of lower performance");
   RNA_def_property_update(prop, NC_SCENE | ND_RENDER_OPTIONS, "rna_Scene_mesh_quality_update");
 
+  prop = RNA_def_property(srna, "use_compressed_uvs", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "perf_flag", SCE_PERF_COMPRESSED_UVS);
+  RNA_def_property_ui_text(
+      prop,
+      "Compressed UVs",
+      "Store viewport UV coordinates used for shading as half floats, halving their GPU memory "
+      "at the cost of precision on large or detailed UV maps. Edit-mode and UV editing keep "
+      "full precision");
+  RNA_def_property_update(prop, NC_SCENE | ND_RENDER_OPTIONS, "rna_Scene_mesh_quality_update");
+
   /* border */
   prop = RNA_def_property(srna, "use_border", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "mode", R_BORDER);
@@ -530,6 +530,16 @@ static void rna_def_volume_render(BlenderRNA *brna)
       "Clipping",
       "Value under which voxels are considered empty space to optimize rendering");
   RNA_def_property_update(prop, 0, "rna_Volume_update_display");
+
+  prop = RNA_def_property(srna, "use_skip_empty_space", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "flag", VOLUME_RENDER_SKIP_EMPTY_SPACE);
+  RNA_def_property_ui_text(
+      prop,
+      "Skip Empty Space",
+      "Do not evaluate the volume shader where all voxels are under the clipping value. Only "
+      "use this when the shader density and emission come from the voxel grids, otherwise "
+      "empty space is rendered incorrectly");
+  RNA_def_property_update(prop, 0, "rna_Volume_update_display");
 }
 
 static void rna_def_volume(BlenderRNA *brna)
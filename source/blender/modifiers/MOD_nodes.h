@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "BLI_sys_types.h"
+
 struct Main;
 struct NodesModifierData;
 struct Object;
@@ -33,6 +35,13 @@ void MOD_nodes_update_interface(struct Object *object, struct NodesModifierData
 
 void MOD_nodes_init(struct Main *bmain, struct NodesModifierData *nmd);
 
+/**
+ * Write the execution profile of all nodes from the latest evaluation of the modifier to a file
+ * in the Chrome trace event format.
+ * \return False when the modifier has not been evaluated yet or the file could not be written.
+ */
+bool MOD_nodes_write_profile_trace(const struct NodesModifierData *nmd, const char *filepath);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
  */
 
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -729,6 +730,20 @@ void MOD_nodes_init(Main *bmain, NodesModifierData *nmd)
   BKE_ntree_update_main_tree(bmain, ntree, nullptr);
 }
 
+bool MOD_nodes_write_profile_trace(const NodesModifierData *nmd, const char *filepath)
+{
+  if (nmd->runtime_eval_log == nullptr) {
+    return false;
+  }
+  const geo_log::ModifierLog &log = *static_cast<geo_log::ModifierLog *>(nmd->runtime_eval_log);
+  std::ofstream file(filepath);
+  if (!file) {
+    return false;
+  }
+  log.write_chrome_trace(file);
+  return file.good();
+}
+
 static void initialize_group_input(NodesModifierData &nmd,
                                    const OutputSocketRef &socket,
                                    void *r_value)
@@ -997,15 +997,8 @@ class GeometryNodesEvaluator {
       params.error_message_add(geo_log::NodeWarningType::Legacy,
                                TIP_("Legacy node will be removed before Blender 4.0"));
     }
-    using Clock = std::chrono::steady_clock;
-    Clock::time_point begin = Clock::now();
+    geo_log::ScopedNodeProfiler profiler{params_.geo_logger, node};
     bnode.typeinfo->geometry_node_execute(params);
-    Clock::time_point end = Clock::now();
-    const std::chrono::microseconds duration =
-        std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
-    if (params_.geo_logger != nullptr) {
-      params_.geo_logger->local().log_execution_time(node, duration);
-    }
   }
 
   void execute_multi_function_node(const DNode node,
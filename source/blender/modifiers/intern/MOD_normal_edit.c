@@ -632,6 +632,8 @@ static Mesh *normalEditModifier_do(NormalEditModifierData *enmd,
 
   MEM_SAFE_FREE(loopnors);
 
+  /* Split normals have to be recalculated from the new custom normals. */
+  BKE_mesh_loop_normals_tag_dirty(result);
   result->runtime.is_original = false;
 
   return result;
@@ -675,6 +675,8 @@ static Mesh *modifyMesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh *
   MEM_SAFE_FREE(wn_data.mode_pair);
   MEM_SAFE_FREE(wn_data.items_data);
 
+  /* Split normals have to be recalculated from the new custom normals. */
+  BKE_mesh_loop_normals_tag_dirty(result);
   result->runtime.is_original = false;
 
   return result;
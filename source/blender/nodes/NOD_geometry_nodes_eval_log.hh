@@ -41,7 +41,9 @@
 
 #include "NOD_derived_node_tree.hh"
 
+#include <atomic>
 #include <chrono>
+#include <iosfwd>
 
 struct SpaceNode;
 struct SpaceSpreadsheet;
@@ -171,9 +173,46 @@ struct NodeWithWarning {
   NodeWarning warning;
 };
 
-struct NodeWithExecutionTime {
+/** Cost of a single execution of a node. */
+struct NodeExecutionProfile {
+  /** Begin and end of the execution, relative to the start of the entire evaluation. */
+  std::chrono::microseconds begin{0};
+  std::chrono::microseconds end{0};
+  /**
+   * Time the executing thread spent on the CPU. This does not include work done by other threads
+   * on behalf of the node. It is zero on platforms where this is not supported.
+   */
+  std::chrono::microseconds cpu_time{0};
+  /**
+   * Time all threads of the process spent on the CPU during the execution, including worker
+   * threads used by the node. Like the memory delta, this is only exact when no other node is
+   * executed at the same time. It is zero on platforms where this is not supported.
+   */
+  std::chrono::microseconds process_cpu_time{0};
+  /** Index of the thread (or rather its #LocalGeoLogger) that executed the node. */
+  int thread_index = 0;
+  /**
+   * Change of the memory allocated with the guarded allocator during the execution. This is only
+   * exact when no other node is executed at the same time.
+   */
+  int64_t memory_delta = 0;
+
+  std::chrono::microseconds duration() const
+  {
+    return end - begin;
+  }
+
+  /** Average number of threads that were busy during the execution. */
+  float threads_used() const
+  {
+    const int64_t duration_us = this->duration().count();
+    return duration_us > 0 ? float(process_cpu_time.count()) / float(duration_us) : 0.0f;
+  }
+};
+
+struct NodeWithExecutionProfile {
   DNode node;
-  std::chrono::microseconds exec_time;
+  NodeExecutionProfile profile;
 };
 
 struct NodeWithDebugMessage {
@@ -201,13 +240,15 @@ class LocalGeoLogger {
   std::unique_ptr<LinearAllocator<>> allocator_;
   Vector<ValueOfSockets> values_;
   Vector<NodeWithWarning> node_warnings_;
-  Vector<NodeWithExecutionTime> node_exec_times_;
+  Vector<NodeWithExecutionProfile> node_exec_profiles_;
+  int thread_index_;
   Vector<NodeWithDebugMessage> node_debug_messages_;
 
   friend ModifierLog;
 
  public:
-  LocalGeoLogger(GeoLogger &main_logger) : main_logger_(&main_logger)
+  LocalGeoLogger(GeoLogger &main_logger, const int thread_index)
+      : main_logger_(&main_logger), thread_index_(thread_index)
   {
     this->allocator_ = std::make_unique<LinearAllocator<>>();
   }
@@ -215,7 +256,11 @@ class LocalGeoLogger {
   void log_value_for_sockets(Span<DSocket> sockets, GPointer value);
   void log_multi_value_socket(DSocket socket, Span<GPointer> values);
   void log_node_warning(DNode node, NodeWarningType type, std::string message);
-  void log_execution_time(DNode node, std::chrono::microseconds exec_time);
+  void log_execution_profile(DNode node, const NodeExecutionProfile &profile);
+  int thread_index() const
+  {
+    return thread_index_;
+  }
   /**
    * Log a message that will be displayed in the node editor next to the node.
    * This should only be used for debugging purposes and not to display information to users.
@@ -233,6 +278,9 @@ class GeoLogger {
    */
   Set<DSocket> log_full_sockets_;
   threading::EnumerableThreadSpecific<LocalGeoLogger> threadlocals_;
+  std::atomic<int> threadlocals_num_ = 0;
+  /** Execution profiles are stored relative to this time. */
+  std::chrono::steady_clock::time_point start_time_;
 
   /* These are only optional since they don't have a default constructor. */
   std::unique_ptr<GeometryValueLog> input_geometry_log_;
@@ -244,7 +292,8 @@ class GeoLogger {
  public:
   GeoLogger(Set<DSocket> log_full_sockets)
       : log_full_sockets_(std::move(log_full_sockets)),
-        threadlocals_([this]() { return LocalGeoLogger(*this); })
+        threadlocals_([this]() { return LocalGeoLogger(*this, threadlocals_num_++); }),
+        start_time_(std::chrono::steady_clock::now())
   {
   }
 
@@ -263,6 +312,11 @@ class GeoLogger {
     return threadlocals_.local();
   }
 
+  std::chrono::steady_clock::time_point start_time() const
+  {
+    return start_time_;
+  }
+
   auto begin()
   {
     return threadlocals_.begin();
@@ -274,6 +328,24 @@ class GeoLogger {
   }
 };
 
+/**
+ * Measures the cost of a node execution from construction until destruction and logs it. Nothing
+ * is measured when the logger is null.
+ */
+class ScopedNodeProfiler : NonCopyable, NonMovable {
+ private:
+  GeoLogger *logger_;
+  DNode node_;
+  std::chrono::steady_clock::time_point begin_;
+  std::chrono::microseconds cpu_time_begin_;
+  std::chrono::microseconds process_cpu_time_begin_;
+  int64_t memory_begin_;
+
+ public:
+  ScopedNodeProfiler(GeoLogger *logger, DNode node);
+  ~ScopedNodeProfiler();
+};
+
 /** Contains information that has been logged for one specific socket. */
 class SocketLog {
  private:
@@ -295,14 +367,14 @@ class NodeLog {
   Vector<SocketLog> output_logs_;
   Vector<NodeWarning, 0> warnings_;
   Vector<std::string, 0> debug_messages_;
-  std::chrono::microseconds exec_time_;
+  /** Nodes that support laziness can be executed more than once. */
+  Vector<NodeExecutionProfile, 1> exec_profiles_;
 
   friend ModifierLog;
 
  public:
   const SocketLog *lookup_socket_log(eNodeSocketInOut in_out, int index) const;
   const SocketLog *lookup_socket_log(const bNode &node, const bNodeSocket &socket) const;
-  void execution_time(std::chrono::microseconds exec_time);
 
   Span<SocketLog> input_logs() const
   {
@@ -324,11 +396,20 @@ class NodeLog {
     return debug_messages_;
   }
 
-  std::chrono::microseconds execution_time() const
+  Span<NodeExecutionProfile> execution_profiles() const
   {
-    return exec_time_;
+    return exec_profiles_;
   }
 
+  /** Total wall-clock time of all executions of the node. */
+  std::chrono::microseconds execution_time() const;
+  /** Total time the executing threads spent on the CPU. */
+  std::chrono::microseconds execution_cpu_time() const;
+  /** Average number of busy threads over all executions of the node. */
+  float execution_threads_used() const;
+  /** Total change of allocated memory over all executions of the node. */
+  int64_t execution_memory_delta() const;
+
   Vector<const GeometryAttributeInfo *> lookup_available_attributes() const;
 };
 
@@ -359,6 +440,14 @@ class ModifierLog {
   std::unique_ptr<GeometryValueLog> input_geometry_log_;
   std::unique_ptr<GeometryValueLog> output_geometry_log_;
 
+  struct ProfiledNode {
+    /** Names of the parent group nodes and the node itself, separated by slashes. */
+    std::string node_path;
+    NodeExecutionProfile profile;
+  };
+  /** All node executions of the evaluation, sorted by begin time. */
+  Vector<ProfiledNode> profiled_nodes_;
+
  public:
   ModifierLog(GeoLogger &logger);
 
@@ -382,6 +471,12 @@ class ModifierLog {
   const GeometryValueLog *input_geometry_log() const;
   const GeometryValueLog *output_geometry_log() const;
 
+  /**
+   * Write all node executions in the Chrome trace event format, which can be opened with
+   * `chrome://tracing` or Perfetto.
+   */
+  void write_chrome_trace(std::ostream &stream) const;
+
  private:
   using LogByTreeContext = Map<const DTreeContext *, TreeLog *>;
 
@@ -209,8 +209,11 @@ static void node_geo_exec(GeoNodeExecParams params)
   geometry_set = geometry::realize_instances_legacy(geometry_set);
 
   /* This isn't required. This node should be rewritten to handle instances
-   * for the target geometry set. However, the generic BVH API complicates this. */
-  geometry_set_target = geometry::realize_instances_legacy(geometry_set_target);
+   * for the target geometry set. However, the generic BVH API complicates this.
+   * Only the positions of the target are used, so none of its generic attributes are realized. */
+  const Set<AttributeIDRef> target_attributes;
+  geometry_set_target = geometry::realize_instances_legacy(geometry_set_target,
+                                                           &target_attributes);
 
   if (geometry_set.has<MeshComponent>()) {
     attribute_calc_proximity(
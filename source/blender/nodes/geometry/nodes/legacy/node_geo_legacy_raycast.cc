@@ -285,7 +285,13 @@ static void node_geo_exec(GeoNodeExecParams params)
   const Array<std::string> hit_output_names = {params.extract_input<std::string>("Hit Attribute")};
 
   geometry_set = geometry::realize_instances_legacy(geometry_set);
-  target_geometry_set = geometry::realize_instances_legacy(target_geometry_set);
+  /* Only the attributes which are transferred to the hit points are needed on the target. */
+  Set<AttributeIDRef> target_attributes;
+  for (const std::string &name : hit_names) {
+    target_attributes.add(name);
+  }
+  target_geometry_set = geometry::realize_instances_legacy(target_geometry_set,
+                                                           &target_attributes);
 
   static const Array<GeometryComponentType> types = {
       GEO_COMPONENT_TYPE_MESH, GEO_COMPONENT_TYPE_POINT_CLOUD, GEO_COMPONENT_TYPE_CURVE};
@@ -18,6 +18,7 @@
 #include "DNA_meshdata_types.h"
 
 #include "BKE_mesh.h"
+#include "BKE_mesh_topology.hh"
 
 #include "node_geometry_util.hh"
 
@@ -49,13 +50,12 @@ class EdgeNeighborCountFieldInput final : public GeometryFieldInput {
         return {};
       }
 
-      Array<int> face_count(mesh->totedge, 0);
-      for (const int i : IndexRange(mesh->totloop)) {
-        face_count[mesh->mloop[i].e]++;
-      }
-
+      const bke::mesh_topology::ElementMap &map = bke::mesh_topology::edge_to_poly_map(*mesh);
       return mesh_component.attribute_try_adapt_domain<int>(
-          VArray<int>::ForContainer(std::move(face_count)), ATTR_DOMAIN_EDGE, domain);
+          VArray<int>::ForFunc(mesh->totedge,
+                               [&map](const int i) { return int(map.group_range(i).size()); }),
+          ATTR_DOMAIN_EDGE,
+          domain);
     }
     return {};
   }
@@ -17,7 +17,10 @@
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
 
+#include "BLI_task.hh"
+
 #include "BKE_mesh.h"
+#include "BKE_mesh_topology.hh"
 
 #include "node_geometry_util.hh"
 
@@ -41,18 +44,18 @@ static VArray<int> construct_neighbor_count_gvarray(const MeshComponent &compone
     return {};
   }
 
-  Array<int> edge_count(mesh->totedge, 0);
-  for (const int i : IndexRange(mesh->totloop)) {
-    edge_count[mesh->mloop[i].e]++;
-  }
+  const bke::mesh_topology::ElementMap &edge_to_poly = bke::mesh_topology::edge_to_poly_map(
+      *mesh);
 
   Array<int> poly_count(mesh->totpoly, 0);
-  for (const int poly_num : IndexRange(mesh->totpoly)) {
-    MPoly &poly = mesh->mpoly[poly_num];
-    for (const int loop_num : IndexRange(poly.loopstart, poly.totloop)) {
-      poly_count[poly_num] += edge_count[mesh->mloop[loop_num].e] - 1;
+  threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+    for (const int poly_num : range) {
+      const MPoly &poly = mesh->mpoly[poly_num];
+      for (const int loop_num : IndexRange(poly.loopstart, poly.totloop)) {
+        poly_count[poly_num] += edge_to_poly.group_range(mesh->mloop[loop_num].e).size() - 1;
+      }
     }
-  }
+  });
 
   return component.attribute_try_adapt_domain<int>(
       VArray<int>::ForContainer(std::move(poly_count)), ATTR_DOMAIN_FACE, domain);
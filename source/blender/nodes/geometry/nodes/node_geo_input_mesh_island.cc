@@ -18,8 +18,7 @@
 #include "DNA_meshdata_types.h"
 
 #include "BKE_mesh.h"
-
-#include "BLI_disjoint_set.hh"
+#include "BKE_mesh_topology.hh"
 
 #include "node_geometry_util.hh"
 
@@ -53,20 +52,8 @@ class IslandFieldInput final : public GeometryFieldInput {
       return {};
     }
 
-    DisjointSet islands(mesh->totvert);
-    for (const int i : IndexRange(mesh->totedge)) {
-      islands.join(mesh->medge[i].v1, mesh->medge[i].v2);
-    }
-
-    Array<int> output(mesh->totvert);
-    VectorSet<int> ordered_roots;
-    for (const int i : IndexRange(mesh->totvert)) {
-      const int64_t root = islands.find_root(i);
-      output[i] = ordered_roots.index_of_or_add(root);
-    }
-
     return mesh_component.attribute_try_adapt_domain<int>(
-        VArray<int>::ForContainer(std::move(output)), ATTR_DOMAIN_POINT, domain);
+        VArray<int>::ForSpan(bke::mesh_topology::vert_islands(*mesh)), ATTR_DOMAIN_POINT, domain);
   }
 
   uint64_t hash() const override
@@ -18,6 +18,7 @@
 #include "DNA_meshdata_types.h"
 
 #include "BKE_mesh.h"
+#include "BKE_mesh_topology.hh"
 
 #include "node_geometry_util.hh"
 
@@ -42,12 +43,9 @@ static VArray<int> construct_vertex_count_gvarray(const MeshComponent &component
   }
 
   if (domain == ATTR_DOMAIN_POINT) {
-    Array<int> vertices(mesh->totvert, 0);
-    for (const int i : IndexRange(mesh->totedge)) {
-      vertices[mesh->medge[i].v1]++;
-      vertices[mesh->medge[i].v2]++;
-    }
-    return VArray<int>::ForContainer(std::move(vertices));
+    const bke::mesh_topology::ElementMap &map = bke::mesh_topology::vert_to_edge_map(*mesh);
+    return VArray<int>::ForFunc(mesh->totvert,
+                                [&map](const int i) { return int(map.group_range(i).size()); });
   }
   return {};
 }
@@ -91,12 +89,9 @@ static VArray<int> construct_face_count_gvarray(const MeshComponent &component,
   }
 
   if (domain == ATTR_DOMAIN_POINT) {
-    Array<int> vertices(mesh->totvert, 0);
-    for (const int i : IndexRange(mesh->totloop)) {
-      int vertex = mesh->mloop[i].v;
-      vertices[vertex]++;
-    }
-    return VArray<int>::ForContainer(std::move(vertices));
+    const bke::mesh_topology::ElementMap &map = bke::mesh_topology::vert_to_poly_map(*mesh);
+    return VArray<int>::ForFunc(mesh->totvert,
+                                [&map](const int i) { return int(map.group_range(i).size()); });
   }
   return {};
 }
@@ -55,8 +55,9 @@ static void geometry_set_mesh_subdivide(GeometrySet &geometry_set, const int lev
       0);
   subdiv_settings.fvar_linear_interpolation = BKE_subdiv_fvar_interpolation_from_uv_smooth(0);
 
-  /* Apply subdivision from mesh. */
-  Subdiv *subdiv = BKE_subdiv_update_from_mesh(nullptr, &subdiv_settings, mesh_in);
+  /* Apply subdivision from mesh. The descriptor is cached, so that the topology refiner is only
+   * created again when the topology changes. */
+  Subdiv *subdiv = BKE_subdiv_cache_acquire(&subdiv_settings, mesh_in);
 
   /* In case of bad topology, skip to input mesh. */
   if (subdiv == nullptr) {
@@ -69,7 +70,7 @@ static void geometry_set_mesh_subdivide(GeometrySet &geometry_set, const int lev
   MeshComponent &mesh_component = geometry_set.get_component_for_write<MeshComponent>();
   mesh_component.replace(mesh_out);
 
-  BKE_subdiv_free(subdiv);
+  BKE_subdiv_cache_release(subdiv);
 }
 
 static void node_geo_exec(GeoNodeExecParams params)
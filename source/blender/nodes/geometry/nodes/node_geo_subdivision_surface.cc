@@ -124,8 +124,9 @@ static void node_geo_exec(GeoNodeExecParams params)
 
     Mesh *mesh_in = mesh_component.get_for_write();
 
-    /* Apply subdivision to mesh. */
-    Subdiv *subdiv = BKE_subdiv_update_from_mesh(nullptr, &subdiv_settings, mesh_in);
+    /* Apply subdivision to mesh. The descriptor is cached, so that the topology refiner is only
+     * created again when the topology changes. */
+    Subdiv *subdiv = BKE_subdiv_cache_acquire(&subdiv_settings, mesh_in);
 
     /* In case of bad topology, skip to input mesh. */
     if (subdiv == nullptr) {
@@ -137,7 +138,7 @@ static void node_geo_exec(GeoNodeExecParams params)
 
     mesh_component.replace(mesh_out);
 
-    BKE_subdiv_free(subdiv);
+    BKE_subdiv_cache_release(subdiv);
   });
 #endif
   params.set_output("Mesh", std::move(geometry_set));
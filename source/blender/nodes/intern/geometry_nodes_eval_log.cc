@@ -25,7 +25,15 @@
 
 #include "BLT_translation.h"
 
+#include "MEM_guardedalloc.h"
+
 #include <chrono>
+#include <iomanip>
+#include <ostream>
+
+#ifndef WIN32
+#  include <time.h>
+#endif
 
 namespace blender::nodes::geometry_nodes_eval_log {
 
@@ -67,10 +75,18 @@ ModifierLog::ModifierLog(GeoLogger &logger)
       node_log.warnings_.append(node_with_warning.warning);
     }
 
-    for (NodeWithExecutionTime &node_with_exec_time : local_logger.node_exec_times_) {
+    for (NodeWithExecutionProfile &node_with_profile : local_logger.node_exec_profiles_) {
       NodeLog &node_log = this->lookup_or_add_node_log(log_by_tree_context,
-                                                       node_with_exec_time.node);
-      node_log.exec_time_ = node_with_exec_time.exec_time;
+                                                       node_with_profile.node);
+      node_log.exec_profiles_.append(node_with_profile.profile);
+
+      std::string node_path = node_with_profile.node->name();
+      for (const DTreeContext *context = node_with_profile.node.context();
+           context->parent_node() != nullptr;
+           context = context->parent_context()) {
+        node_path = context->parent_node()->name() + "/" + node_path;
+      }
+      profiled_nodes_.append({std::move(node_path), node_with_profile.profile});
     }
 
     for (NodeWithDebugMessage &debug_message : local_logger.node_debug_messages_) {
@@ -78,6 +94,12 @@ ModifierLog::ModifierLog(GeoLogger &logger)
       node_log.debug_messages_.append(debug_message.message);
     }
   }
+
+  std::sort(profiled_nodes_.begin(),
+            profiled_nodes_.end(),
+            [](const ProfiledNode &a, const ProfiledNode &b) {
+              return a.profile.begin < b.profile.begin;
+            });
 }
 
 TreeLog &ModifierLog::lookup_or_add_tree_log(LogByTreeContext &log_by_tree_context,
@@ -138,6 +160,51 @@ const GeometryValueLog *ModifierLog::output_geometry_log() const
   return output_geometry_log_.get();
 }
 
+static void write_json_string(std::ostream &stream, StringRef str)
+{
+  stream << '"';
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+        }
+        else {
+          stream << c;
+        }
+        break;
+    }
+  }
+  stream << '"';
+}
+
+void ModifierLog::write_chrome_trace(std::ostream &stream) const
+{
+  stream << "{\"traceEvents\":[\n";
+  for (const int i : profiled_nodes_.index_range()) {
+    const ProfiledNode &profiled_node = profiled_nodes_[i];
+    const NodeExecutionProfile &profile = profiled_node.profile;
+    stream << "{\"name\":";
+    write_json_string(stream, profiled_node.node_path);
+    stream << ",\"cat\":\"node\",\"ph\":\"X\",\"pid\":0";
+    stream << ",\"tid\":" << profile.thread_index;
+    stream << ",\"ts\":" << profile.begin.count();
+    stream << ",\"dur\":" << profile.duration().count();
+    stream << ",\"args\":{\"cpu_time_us\":" << profile.cpu_time.count();
+    stream << ",\"process_cpu_time_us\":" << profile.process_cpu_time.count();
+    stream << ",\"threads_used\":" << profile.threads_used();
+    stream << ",\"memory_delta\":" << profile.memory_delta << "}}";
+    stream << (i + 1 < profiled_nodes_.size() ? ",\n" : "\n");
+  }
+  stream << "]}\n";
+}
+
 const NodeLog *TreeLog::lookup_node_log(StringRef node_name) const
 {
   const destruct_ptr<NodeLog> *node_log = node_logs_.lookup_ptr_as(node_name);
@@ -283,6 +350,43 @@ GeometryValueLog::GeometryValueLog(const GeometrySet &geometry_set, bool log_ful
   }
 }
 
+std::chrono::microseconds NodeLog::execution_time() const
+{
+  std::chrono::microseconds exec_time{0};
+  for (const NodeExecutionProfile &profile : exec_profiles_) {
+    exec_time += profile.duration();
+  }
+  return exec_time;
+}
+
+std::chrono::microseconds NodeLog::execution_cpu_time() const
+{
+  std::chrono::microseconds cpu_time{0};
+  for (const NodeExecutionProfile &profile : exec_profiles_) {
+    cpu_time += profile.cpu_time;
+  }
+  return cpu_time;
+}
+
+float NodeLog::execution_threads_used() const
+{
+  std::chrono::microseconds process_cpu_time{0};
+  for (const NodeExecutionProfile &profile : exec_profiles_) {
+    process_cpu_time += profile.process_cpu_time;
+  }
+  const int64_t exec_time_us = this->execution_time().count();
+  return exec_time_us > 0 ? float(process_cpu_time.count()) / float(exec_time_us) : 0.0f;
+}
+
+int64_t NodeLog::execution_memory_delta() const
+{
+  int64_t memory_delta = 0;
+  for (const NodeExecutionProfile &profile : exec_profiles_) {
+    memory_delta += profile.memory_delta;
+  }
+  return memory_delta;
+}
+
 Vector<const GeometryAttributeInfo *> NodeLog::lookup_available_attributes() const
 {
   Vector<const GeometryAttributeInfo *> attributes;
@@ -486,9 +590,9 @@ void LocalGeoLogger::log_node_warning(DNode node, NodeWarningType type, std::str
   node_warnings_.append({node, {type, std::move(message)}});
 }
 
-void LocalGeoLogger::log_execution_time(DNode node, std::chrono::microseconds exec_time)
+void LocalGeoLogger::log_execution_profile(DNode node, const NodeExecutionProfile &profile)
 {
-  node_exec_times_.append({node, exec_time});
+  node_exec_profiles_.append({node, profile});
 }
 
 void LocalGeoLogger::log_debug_message(DNode node, std::string message)
@@ -496,4 +600,70 @@ void LocalGeoLogger::log_debug_message(DNode node, std::string message)
   node_debug_messages_.append({node, std::move(message)});
 }
 
+#ifndef WIN32
+/** CPU time measured by the given clock, or zero when it is not supported. */
+static std::chrono::microseconds clock_cpu_time_now(const clockid_t clock_id)
+{
+  timespec time;
+  if (clock_gettime(clock_id, &time) != 0) {
+    return std::chrono::microseconds(0);
+  }
+  return std::chrono::seconds(time.tv_sec) +
+         std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::nanoseconds(time.tv_nsec));
+}
+#endif
+
+/** Time the calling thread spent on the CPU so far, or zero when that is not supported. */
+static std::chrono::microseconds thread_cpu_time_now()
+{
+#ifdef WIN32
+  return std::chrono::microseconds(0);
+#else
+  return clock_cpu_time_now(CLOCK_THREAD_CPUTIME_ID);
+#endif
+}
+
+/** Time all threads of the process spent on the CPU so far, or zero when not supported. */
+static std::chrono::microseconds process_cpu_time_now()
+{
+#ifdef WIN32
+  return std::chrono::microseconds(0);
+#else
+  return clock_cpu_time_now(CLOCK_PROCESS_CPUTIME_ID);
+#endif
+}
+
+ScopedNodeProfiler::ScopedNodeProfiler(GeoLogger *logger, DNode node)
+    : logger_(logger), node_(node)
+{
+  if (logger_ == nullptr) {
+    return;
+  }
+  memory_begin_ = int64_t(MEM_get_memory_in_use());
+  cpu_time_begin_ = thread_cpu_time_now();
+  process_cpu_time_begin_ = process_cpu_time_now();
+  begin_ = std::chrono::steady_clock::now();
+}
+
+ScopedNodeProfiler::~ScopedNodeProfiler()
+{
+  if (logger_ == nullptr) {
+    return;
+  }
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  LocalGeoLogger &local_logger = logger_->local();
+
+  NodeExecutionProfile profile;
+  profile.begin = duration_cast<microseconds>(begin_ - logger_->start_time());
+  profile.end = duration_cast<microseconds>(end - logger_->start_time());
+  profile.cpu_time = thread_cpu_time_now() - cpu_time_begin_;
+  profile.process_cpu_time = process_cpu_time_now() - process_cpu_time_begin_;
+  profile.thread_index = local_logger.thread_index();
+  profile.memory_delta = int64_t(MEM_get_memory_in_use()) - memory_begin_;
+  local_logger.log_execution_profile(node_, profile);
+}
+
 }  // namespace blender::nodes::geometry_nodes_eval_log
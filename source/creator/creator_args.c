@@ -45,6 +45,7 @@
 
 #  include "BLO_readfile.h" /* only for BLO_has_bfile_extension */
 
+#  include "BKE_blender.h"
 #  include "BKE_blender_version.h"
 #  include "BKE_context.h"
 
@@ -589,6 +590,8 @@ static int arg_handle_print_help(int UNUSED(argc), const char **UNUSED(argv), vo
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-time");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-pretty");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-uuid");
+  BLI_args_print_arg_doc(ba, "--debug-depsgraph-trace");
+  BLI_args_print_arg_doc(ba, "--debug-depsgraph-trace-events");
   BLI_args_print_arg_doc(ba, "--debug-ghost");
   BLI_args_print_arg_doc(ba, "--debug-gpu");
   BLI_args_print_arg_doc(ba, "--debug-gpu-force-workarounds");
@@ -1075,6 +1078,63 @@ static int arg_handle_debug_mode_memory_set(int UNUSED(argc),
   return 0;
 }
 
+/* Set by `--debug-depsgraph-trace-events`, zero for the default. */
+static int debug_depsgraph_trace_events_num = 0;
+
+static const char arg_handle_debug_depsgraph_trace_events_set_doc[] =
+    "<count>\n"
+    "\tNumber of the newest events kept by '--debug-depsgraph-trace' (default 1048576),\n"
+    "\tmust be passed before it.";
+static int arg_handle_debug_depsgraph_trace_events_set(int argc,
+                                                       const char **argv,
+                                                       void *UNUSED(data))
+{
+  const char *arg_id = "--debug-depsgraph-trace-events";
+  const int min = 1, max = INT_MAX;
+  if (argc > 1) {
+    const char *err_msg = NULL;
+    if (!parse_int_strict_range(
+            argv[1], NULL, min, max, &debug_depsgraph_trace_events_num, &err_msg)) {
+      printf("\nError: %s '%s %s', expected number in [%d..%d].\n",
+             err_msg,
+             arg_id,
+             argv[1],
+             min,
+             max);
+    }
+    return 1;
+  }
+  printf("\nError: you must specify a number of events '%s'.\n", arg_id);
+  return 0;
+}
+
+static const char arg_handle_debug_depsgraph_trace_set_doc[] =
+    "<filename>\n"
+    "\tRecord the evaluation of all dependency graph operations and write them to a Chrome trace\n"
+    "\tJSON file on exit. Only the newest events are kept, see '--debug-depsgraph-trace-events'.";
+static void debug_depsgraph_trace_atexit(void *user_data)
+{
+  char *filepath = (char *)user_data;
+  DEG_debug_trace_end(filepath);
+  MEM_freeN(filepath);
+}
+static int arg_handle_debug_depsgraph_trace_set(int argc,
+                                                const char **argv,
+                                                void *UNUSED(data))
+{
+  const char *arg_id = "--debug-depsgraph-trace";
+  if (argc > 1) {
+    char *filepath = MEM_mallocN(FILE_MAX, __func__);
+    BLI_strncpy(filepath, argv[1], FILE_MAX);
+    BLI_path_abs_from_cwd(filepath, FILE_MAX);
+    DEG_debug_trace_begin(debug_depsgraph_trace_events_num);
+    BKE_blender_atexit_register(debug_depsgraph_trace_atexit, filepath);
+    return 1;
+  }
+  printf("\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_value_set_doc[] =
     "<value>\n"
     "\tSet debug value of <value> on startup.";
@@ -2198,6 +2258,13 @@ void main_args_setup(bContext *C, bArgs *ba)
                "--debug-depsgraph-uuid",
                CB_EX(arg_handle_debug_mode_generic_set, depsgraph_uuid),
                (void *)G_DEBUG_DEPSGRAPH_UUID);
+  BLI_args_add(
+      ba, NULL, "--debug-depsgraph-trace", CB(arg_handle_debug_depsgraph_trace_set), NULL);
+  BLI_args_add(ba,
+               NULL,
+               "--debug-depsgraph-trace-events",
+               CB(arg_handle_debug_depsgraph_trace_events_set),
+               NULL);
   BLI_args_add(ba,
                NULL,
                "--debug-gpu-force-workarounds",
@@ -0,0 +1,106 @@
+# Apache License, Version 2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    bpy.ops.wm.read_factory_settings(use_empty=True)
+    scene = bpy.context.scene
+    scene.render.engine = 'CYCLES'
+    scene.render.resolution_x = 640
+    scene.render.resolution_y = 360
+    scene.render.filepath = args['render_filepath']
+    scene.render.image_settings.file_format = 'PNG'
+    scene.cycles.device = 'CPU'
+    scene.cycles.samples = 16
+    scene.cycles.use_adaptive_sampling = False
+    scene.cycles.use_denoising = False
+
+    bpy.ops.object.camera_add(location=(0.0, -12.0, 0.0), rotation=(1.5708, 0.0, 0.0))
+    scene.camera = bpy.context.active_object
+    bpy.ops.object.light_add(type='SUN', rotation=(0.6, 0.3, 0.0))
+
+    material = bpy.data.materials.new("Cloud")
+    material.use_nodes = True
+    nodes = material.node_tree.nodes
+    nodes.clear()
+    volume = nodes.new('ShaderNodeVolumePrincipled')
+    volume.inputs['Density'].default_value = 5.0
+    output = nodes.new('ShaderNodeOutputMaterial')
+    material.node_tree.links.new(volume.outputs[0], output.inputs['Volume'])
+
+    # Sparse cloud: small blobs scattered over a large shell, so that most voxels inside the
+    # leaf nodes of the grid are empty. The blobs are made with geometry nodes on a mesh object
+    # that is hidden from rendering, and converted to a volume object with the Mesh to Volume
+    # modifier, so that the volume keeps its own render settings.
+    group = bpy.data.node_groups.new("Blobs", 'GeometryNodeTree')
+    group.outputs.new('NodeSocketGeometry', "Geometry")
+    group_output = group.nodes.new('NodeGroupOutput')
+    shell = group.nodes.new('GeometryNodeMeshIcoSphere')
+    shell.inputs['Radius'].default_value = args['radius']
+    shell.inputs['Subdivisions'].default_value = 4
+    distribute = group.nodes.new('GeometryNodeDistributePointsOnFaces')
+    distribute.inputs['Density'].default_value = 2.0
+    blob = group.nodes.new('GeometryNodeMeshIcoSphere')
+    blob.inputs['Radius'].default_value = 0.08
+    blob.inputs['Subdivisions'].default_value = 1
+    instance = group.nodes.new('GeometryNodeInstanceOnPoints')
+    realize = group.nodes.new('GeometryNodeRealizeInstances')
+    group.links.new(shell.outputs['Mesh'], distribute.inputs['Mesh'])
+    group.links.new(distribute.outputs['Points'], instance.inputs['Points'])
+    group.links.new(blob.outputs['Mesh'], instance.inputs['Instance'])
+    group.links.new(instance.outputs['Instances'], realize.inputs['Geometry'])
+    group.links.new(realize.outputs['Geometry'], group_output.inputs[0])
+
+    bpy.ops.mesh.primitive_plane_add()
+    blobs = bpy.context.active_object
+    blobs.hide_render = True
+    modifier = blobs.modifiers.new("Nodes", 'NODES')
+    modifier.node_group = group
+
+    bpy.ops.object.volume_add()
+    ob = bpy.context.active_object
+    ob.data.materials.append(material)
+    ob.data.render.use_skip_empty_space = args['skip_empty_space']
+    modifier = ob.modifiers.new("Mesh to Volume", 'MESH_TO_VOLUME')
+    modifier.object = blobs
+    modifier.resolution_mode = 'VOXEL_SIZE'
+    modifier.voxel_size = 0.02
+    modifier.use_fill_volume = True
+
+    start_time = time.time()
+    bpy.ops.render.render(write_still=True)
+    elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class CyclesVolumeTest(api.Test):
+    def __init__(self, name, radius, skip_empty_space):
+        self.test_name = name
+        self.radius = radius
+        self.skip_empty_space = skip_empty_space
+
+    def name(self):
+        return self.test_name
+
+    def category(self):
+        return "cycles"
+
+    def run(self, env, device_id):
+        args = {'radius': self.radius,
+                'skip_empty_space': self.skip_empty_space,
+                'render_filepath': str(env.log_file.parent / (env.log_file.stem + '.png'))}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    return [CyclesVolumeTest('sparse_cloud', 3.0, False),
+            CyclesVolumeTest('sparse_cloud_skip_empty', 3.0, True),
+            CyclesVolumeTest('sparse_cloud_large', 4.5, False),
+            CyclesVolumeTest('sparse_cloud_large_skip_empty', 4.5, True)]
@@ -0,0 +1,66 @@
+# Apache License, Version 2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    bpy.ops.wm.read_factory_settings()
+    scene = bpy.context.scene
+    scene.render.use_compressed_uvs = args['use_compressed_uvs']
+
+    for ob in list(scene.objects):
+        if ob.type == 'MESH':
+            bpy.data.objects.remove(ob)
+
+    # Dense UV mapped grid, so that the UV extraction is a measurable part of the mesh batch cache.
+    bpy.ops.mesh.primitive_grid_add(x_subdivisions=500, y_subdivisions=500, size=2.0)
+    ob = bpy.context.active_object
+
+    window = bpy.context.window_manager.windows[0]
+    area = next(area for area in window.screen.areas if area.type == 'VIEW_3D')
+    region = next(region for region in area.regions if region.type == 'WINDOW')
+    # Texture color shading requests the UV buffer.
+    area.spaces.active.shading.type = 'SOLID'
+    area.spaces.active.shading.color_type = 'TEXTURE'
+
+    override = {'window': window, 'screen': window.screen, 'area': area, 'region': region}
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_redraws = 0
+
+    while elapsed_time < 10.0:
+        # Tag the mesh so every redraw rebuilds its batch cache.
+        ob.data.update()
+        bpy.ops.wm.redraw_timer(override, type='DRAW', iterations=1)
+
+        num_redraws += 1
+        elapsed_time = time.time() - start_time
+
+    time_per_redraw = elapsed_time / num_redraws
+
+    result = {'time': time_per_redraw}
+    return result
+
+
+class DrawCacheTest(api.Test):
+    def __init__(self, use_compressed_uvs):
+        self.use_compressed_uvs = use_compressed_uvs
+
+    def name(self):
+        return "uv_compressed" if self.use_compressed_uvs else "uv"
+
+    def category(self):
+        return "draw_cache"
+
+    def run(self, env, device_id):
+        args = {'use_compressed_uvs': self.use_compressed_uvs}
+        result, _ = env.run_in_blender(_run, args, foreground=True)
+        return result
+
+
+def generate(env):
+    return [DrawCacheTest(use_compressed_uvs) for use_compressed_uvs in (False, True)]
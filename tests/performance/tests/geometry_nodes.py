@@ -0,0 +1,71 @@
+# Apache License, Version 2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    bpy.ops.wm.read_factory_settings(use_empty=True)
+    scene = bpy.context.scene
+    scene.frame_start = 1
+    scene.frame_end = 10
+
+    # Dense grid, deformed by an animated modifier so that only positions change every frame.
+    bpy.ops.mesh.primitive_grid_add(x_subdivisions=200, y_subdivisions=200, size=2.0)
+    ob = bpy.context.active_object
+    ob.modifiers.new("Wave", 'WAVE')
+
+    group = bpy.data.node_groups.new("Subdivide", 'GeometryNodeTree')
+    group.inputs.new('NodeSocketGeometry', "Geometry")
+    group.outputs.new('NodeSocketGeometry', "Geometry")
+    group_input = group.nodes.new('NodeGroupInput')
+    group_output = group.nodes.new('NodeGroupOutput')
+    subdivide = group.nodes.new(args['node_type'])
+    subdivide.inputs['Level'].default_value = 2
+    group.links.new(group_input.outputs[0], subdivide.inputs[0])
+    group.links.new(subdivide.outputs[0], group_output.inputs[0])
+
+    modifier = ob.modifiers.new("Nodes", 'NODES')
+    modifier.node_group = group
+
+    depsgraph = bpy.context.evaluated_depsgraph_get()
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_frames = 0
+
+    while elapsed_time < 10.0:
+        for i in range(scene.frame_start, scene.frame_end + 1):
+            scene.frame_set(i)
+            ob.evaluated_get(depsgraph)
+
+        num_frames += scene.frame_end + 1 - scene.frame_start
+        elapsed_time = time.time() - start_time
+
+    time_per_frame = elapsed_time / num_frames
+
+    result = {'time': time_per_frame}
+    return result
+
+
+class GeometryNodesSubdivisionTest(api.Test):
+    def __init__(self, node_type):
+        self.node_type = node_type
+
+    def name(self):
+        return self.node_type
+
+    def category(self):
+        return "geometry_nodes"
+
+    def run(self, env, device_id):
+        args = {'node_type': self.node_type}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    node_types = ['GeometryNodeSubdivisionSurface', 'GeometryNodeSubdivideMesh']
+    return [GeometryNodesSubdivisionTest(node_type) for node_type in node_types]